@@ -139,12 +139,15 @@ HEADERS += \
         ../../Source/MediaInfo/Image/File_Tga.h \
         ../../Source/MediaInfo/Image/File_Tiff.h \
         ../../Source/MediaInfo/MediaInfo.h \
+        ../../Source/MediaInfo/MediaInfo_Binary.h \
+        ../../Source/MediaInfo/MediaInfo_Cache.h \
         ../../Source/MediaInfo/MediaInfo_Config.h \
         ../../Source/MediaInfo/MediaInfo_Config_MediaInfo.h \
         ../../Source/MediaInfo/MediaInfo_Config_PerPackage.h \
         ../../Source/MediaInfo/MediaInfo_Const.h \
         ../../Source/MediaInfo/MediaInfo_Events.h \
         ../../Source/MediaInfo/MediaInfo_Events_Internal.h \
+        ../../Source/MediaInfo/MediaInfo_Events_Ring.h \
         ../../Source/MediaInfo/MediaInfo_Internal.h \
         ../../Source/MediaInfo/MediaInfo_Internal_Const.h \
         ../../Source/MediaInfo/MediaInfoList.h \
@@ -384,10 +387,13 @@ SOURCES += \
         ../../Source/MediaInfo/Image/File_Tga.cpp \
         ../../Source/MediaInfo/Image/File_WebP.cpp \
         ../../Source/MediaInfo/MediaInfo.cpp \
+        ../../Source/MediaInfo/MediaInfo_Binary.cpp \
+        ../../Source/MediaInfo/MediaInfo_Cache.cpp \
         ../../Source/MediaInfo/MediaInfo_Config.cpp \
         ../../Source/MediaInfo/MediaInfo_Config_Automatic.cpp \
         ../../Source/MediaInfo/MediaInfo_Config_MediaInfo.cpp \
         ../../Source/MediaInfo/MediaInfo_Config_PerPackage.cpp \
+        ../../Source/MediaInfo/MediaInfo_Events_Ring.cpp \
         ../../Source/MediaInfo/MediaInfo_File.cpp \
         ../../Source/MediaInfo/MediaInfo_Inform.cpp \
         ../../Source/MediaInfo/MediaInfo_Internal.cpp \
@@ -63,6 +63,8 @@ cp -r ../Source/ThirdParty/sha2-gladman/*.c MediaInfo_Lib_GNU_FromSource/Source/
 mkdir -p MediaInfo_Lib_GNU_FromSource/Source/ThirdParty/tinyxml2
 cp -r ../Source/ThirdParty/tinyxml2/*.h MediaInfo_Lib_GNU_FromSource/Source/ThirdParty/tinyxml2/
 cp -r ../Source/ThirdParty/tinyxml2/*.cpp MediaInfo_Lib_GNU_FromSource/Source/ThirdParty/tinyxml2/
+mkdir -p MediaInfo_Lib_GNU_FromSource/Source/ThirdParty/xxhash
+cp -r ../Source/ThirdParty/xxhash/* MediaInfo_Lib_GNU_FromSource/Source/ThirdParty/xxhash/
 mkdir -p MediaInfo_Lib_GNU_FromSource/Source/MediaInfo
 cp -r ../Source/MediaInfo/*.h MediaInfo_Lib_GNU_FromSource/Source/MediaInfo/
 cp -r ../Source/MediaInfo/*.cpp MediaInfo_Lib_GNU_FromSource/Source/MediaInfo/
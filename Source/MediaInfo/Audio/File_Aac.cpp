@@ -455,9 +455,13 @@ bool File_Aac::Synchronize_ADTS()
     //Synchronizing
     while (Buffer_Offset+6<=Buffer_Size)
     {
-         while (Buffer_Offset+6<=Buffer_Size && (Buffer[Buffer_Offset  ]!=0xFF
-                                              || (Buffer[Buffer_Offset+1]&0xF6)!=0xF0))
+        while (Buffer_Offset+6<=Buffer_Size)
+        {
+            Buffer_Offset=Find_Byte(Buffer, Buffer_Offset, Buffer_Size-5, 0xFF);
+            if (Buffer_Offset+6>Buffer_Size || (Buffer[Buffer_Offset+1]&0xF6)==0xF0)
+                break;
             Buffer_Offset++;
+        }
 
         if (Buffer_Offset+6<=Buffer_Size)//Testing if size is coherant
         {
@@ -21,6 +21,9 @@
 #include "MediaInfo/MediaInfo_Config_MediaInfo.h"
 #include "MediaInfo/MediaInfo_Config.h"
 #include "MediaInfo/MediaInfo_Internal.h" //Only for XML escape. TODO: move XML escape function somewhere more generic
+#if MEDIAINFO_TRACE && MEDIAINFO_EVENTS
+    #include "MediaInfo/OutputHelpers.h" //For Inform_Sink
+#endif //MEDIAINFO_TRACE && MEDIAINFO_EVENTS
 #if MEDIAINFO_IBIUSAGE && MEDIAINFO_SEEK
     #include "MediaInfo/Multiple/File_Ibi.h"
 #endif //MEDIAINFO_IBIUSAGE && MEDIAINFO_SEEK
@@ -44,6 +47,24 @@ using namespace tinyxml2;
     #define memcpy_Unaligned_Unaligned std::memcpy
     #define memcpy_Unaligned_Unaligned_Once1024 std::memcpy
 #endif //MEDIAINFO_SSE2_YES
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP>=2)
+    #include <emmintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #endif //defined(_MSC_VER)
+    #define MEDIAINFO_FIND_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    #include <arm_neon.h>
+    #define MEDIAINFO_FIND_NEON
+#endif
+#if MEDIAINFO_ADVANCED
+    #include <chrono>
+    #include <ctime>
+    #ifdef WINDOWS
+        #undef __TEXT
+        #include <windows.h>
+    #endif //WINDOWS
+#endif //MEDIAINFO_ADVANCED
 //---------------------------------------------------------------------------
 
 namespace MediaInfoLib
@@ -53,6 +74,83 @@ namespace MediaInfoLib
 extern MediaInfo_Config Config;
 //---------------------------------------------------------------------------
 
+//***************************************************************************
+// Profile
+//***************************************************************************
+
+//---------------------------------------------------------------------------
+#if MEDIAINFO_ADVANCED
+//In microseconds
+static int64u Profile_Time_Wall_Get()
+{
+    return (int64u)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//In microseconds, for the current thread if possible
+static int64u Profile_Time_CPU_Get()
+{
+    #if defined(WINDOWS)
+        FILETIME Creation, Exit, Kernel, User;
+        if (!GetThreadTimes(GetCurrentThread(), &Creation, &Exit, &Kernel, &User))
+            return 0;
+        return ((((int64u)Kernel.dwHighDateTime)<<32 | Kernel.dwLowDateTime)
+              + (((int64u)User.dwHighDateTime  )<<32 | User.dwLowDateTime  ))/10;
+    #elif defined(CLOCK_THREAD_CPUTIME_ID)
+        timespec Time;
+        if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &Time))
+            return 0;
+        return ((int64u)Time.tv_sec)*1000000+Time.tv_nsec/1000;
+    #else
+        return ((int64u)clock())*1000000/CLOCKS_PER_SEC;
+    #endif
+}
+
+//Time spent in a parser call, time spent in nested calls of other parsers excluded
+class File__Analyze_Profile
+{
+public:
+    File__Analyze_Profile(File__Analyze* Parser_)
+    {
+        Parser=Parser_->Profile_IsActive?Parser_:NULL;
+        if (!Parser)
+            return;
+        Parent=Current;
+        Current=this;
+        Sub_Wall=0;
+        Sub_CPU=0;
+        Begin_Wall=Profile_Time_Wall_Get();
+        Begin_CPU=Profile_Time_CPU_Get();
+    }
+
+    ~File__Analyze_Profile()
+    {
+        if (!Parser)
+            return;
+        int64u Wall=Profile_Time_Wall_Get()-Begin_Wall;
+        int64u CPU=Profile_Time_CPU_Get()-Begin_CPU;
+        Current=Parent;
+        if (Parent)
+        {
+            Parent->Sub_Wall+=Wall;
+            Parent->Sub_CPU+=CPU;
+        }
+        Parser->Profile_Calls++;
+        Parser->Profile_Time_Wall+=Wall>Sub_Wall?(Wall-Sub_Wall):0;
+        Parser->Profile_Time_CPU+=CPU>Sub_CPU?(CPU-Sub_CPU):0;
+    }
+
+private:
+    File__Analyze*          Parser;
+    File__Analyze_Profile*  Parent;
+    int64u                  Begin_Wall;
+    int64u                  Begin_CPU;
+    int64u                  Sub_Wall;
+    int64u                  Sub_CPU;
+    static thread_local File__Analyze_Profile* Current;
+};
+thread_local File__Analyze_Profile* File__Analyze_Profile::Current=NULL;
+#endif //MEDIAINFO_ADVANCED
+
 //***************************************************************************
 // Info
 //***************************************************************************
@@ -603,6 +701,19 @@ File__Analyze::File__Analyze ()
     Frame_Count_NotParsedIncluded=(int64u)-1;
     FrameNumber_PresentationOrder=(int64u)-1;
 
+    //Profile
+    #if MEDIAINFO_ADVANCED
+        Profile_IsActive=false;
+        Profile_IsFlushed=false;
+        Profile_Calls=0;
+        Profile_Time_Wall=0;
+        Profile_Time_CPU=0;
+        Profile_Bytes=0;
+        Profile_Seeks=0;
+        Profile_Buffer_Reallocations=0;
+        Profile_SubParsers=0;
+    #endif //MEDIAINFO_ADVANCED
+
     //Configuration
     DataMustAlwaysBeComplete=true;
     MustUseAlternativeParser=false;
@@ -705,6 +816,11 @@ File__Analyze::File__Analyze ()
         Hash_ParseUpTo=0;
     #endif //MEDIAINFO_HASH
 
+    //Fingerprint
+    #if MEDIAINFO_FINGERPRINT
+        Fingerprint=NULL;
+    #endif //MEDIAINFO_FINGERPRINT
+
     #if MEDIAINFO_CONFORMANCE
         Conformance_Data=nullptr;
     #endif //MEDIAINFO_CONFORMANCE
@@ -723,6 +839,12 @@ File__Analyze::File__Analyze ()
 //---------------------------------------------------------------------------
 File__Analyze::~File__Analyze ()
 {
+    //Profile
+    #if MEDIAINFO_ADVANCED
+        if (Profile_IsActive)
+            Profile_Flush();
+    #endif //MEDIAINFO_ADVANCED
+
     //Buffer
     delete[] Buffer_Temp; //Buffer_Temp=NULL;
     delete[] OriginalBuffer;
@@ -743,6 +865,11 @@ File__Analyze::~File__Analyze ()
         delete Hash; //Hash=NULL;
     #endif //MEDIAINFO_HASH
 
+    //Fingerprint
+    #if MEDIAINFO_FINGERPRINT
+        delete Fingerprint; //Fingerprint=NULL;
+    #endif //MEDIAINFO_FINGERPRINT
+
     #if MEDIAINFO_CONFORMANCE
         delete (conformance_data*)Conformance_Data;
     #endif //MEDIAINFO_CONFORMANCE
@@ -828,6 +955,9 @@ void File__Analyze::Open_Buffer_Init (int64u File_Size_)
     #if MEDIAINFO_ADVANCED
         if (!IsSub && !Config->TimeCode_Dumps && MediaInfoLib::Config.Inform_Get().MakeLowerCase()==__T("timecodexml"))
             Config->TimeCode_Dumps=new map<string, MediaInfo_Config_MediaInfo::timecode_dump>;
+        if (!IsSub && !Config->File_Profile_Get() && MediaInfoLib::Config.Inform_Get().MakeLowerCase()==__T("profile"))
+            Config->File_Profile_Set(true);
+        Profile_IsActive=Config->File_Profile_Get();
     #endif //MEDIAINFO_ADVANCED
 }
 
@@ -866,6 +996,10 @@ void File__Analyze::Open_Buffer_Init (File__Analyze* Sub, int64u File_Size_)
     #endif //MEDIAINFO_EVENTS
     Sub->IsSub=true;
     Sub->File_Name_WithoutDemux=IsSub?File_Name_WithoutDemux:File_Name;
+    #if MEDIAINFO_ADVANCED
+        if (Profile_IsActive && !Sub->Profile_IsActive)
+            Profile_SubParsers++;
+    #endif //MEDIAINFO_ADVANCED
     Sub->Open_Buffer_Init(File_Size_);
 }
 
@@ -933,6 +1067,12 @@ void File__Analyze::Trace_Details_Handling(File__Analyze* Sub)
 //---------------------------------------------------------------------------
 void File__Analyze::Open_Buffer_Continue (const int8u* ToAdd, size_t ToAdd_Size)
 {
+    #if MEDIAINFO_ADVANCED
+        File__Analyze_Profile Profile_Scope(this);
+        if (Profile_IsActive)
+            Profile_Bytes+=ToAdd_Size;
+    #endif //MEDIAINFO_ADVANCED
+
     //Deleyed events
     #if MEDIAINFO_DEMUX
         if (Config->Events_Delayed_CurrentSource)
@@ -957,7 +1097,7 @@ void File__Analyze::Open_Buffer_Continue (const int8u* ToAdd, size_t ToAdd_Size)
         {
             if (!IsSub && !Buffer_Temp_Size && File_Offset==Config->File_Current_Offset && Config->File_Hash_Get().to_ulong())
             {
-                delete Hash; Hash=new HashWrapper(Config->File_Hash_Get().to_ulong());
+                delete Hash; Hash=new HashWrapper(Config->File_Hash_Get().to_ulong(), true); //Hashing overlaps with parsing
             }
             if (Hash)
             {
@@ -976,6 +1116,17 @@ void File__Analyze::Open_Buffer_Continue (const int8u* ToAdd, size_t ToAdd_Size)
         }
     #endif //MEDIAINFO_HASH
 
+    //Fingerprint
+    #if MEDIAINFO_FINGERPRINT
+        if (ToAdd_Size && !IsSub)
+        {
+            if (!Fingerprint && Config->File_Fingerprint_Get() && Config->File_Names.size()<=1 && File_Size!=(int64u)-1)
+                Fingerprint=new HashFingerprint(File_Size, Config->File_Fingerprint_Get());
+            if (Fingerprint)
+                Fingerprint->Update(File_Offset+Buffer_Size, ToAdd, ToAdd_Size);
+        }
+    #endif //MEDIAINFO_FINGERPRINT
+
     //AES
     #if MEDIAINFO_AES
         if (ToAdd_Size)
@@ -1030,7 +1181,13 @@ void File__Analyze::Open_Buffer_Continue (const int8u* ToAdd, size_t ToAdd_Size)
 
     //Integrity
     if (Status[IsFinished])
+    {
+        #if MEDIAINFO_FINGERPRINT
+            if (Fingerprint)
+                File_Offset+=ToAdd_Size; //Only sampled blocks are read, the buffer is empty (see Fingerprint_Continue())
+        #endif //MEDIAINFO_FINGERPRINT
         return;
+    }
     //{File F; F.Open(Ztring(__T("d:\\direct"))+Ztring::ToZtring((size_t)this, 16), File::Access_Write_Append); F.Write(ToAdd, ToAdd_Size);}
 
     //Demand to go elsewhere
@@ -1055,6 +1212,9 @@ void File__Analyze::Open_Buffer_Continue (const int8u* ToAdd, size_t ToAdd_Size)
             if (Buffer_Temp_Size_Max_ToAdd<Buffer_Temp_Size_Max) Buffer_Temp_Size_Max_ToAdd=Buffer_Temp_Size_Max;
             Buffer_Temp_Size_Max+=Buffer_Temp_Size_Max_ToAdd;
             Buffer_Temp=new int8u[Buffer_Temp_Size_Max];
+            #if MEDIAINFO_ADVANCED
+                Profile_Buffer_Reallocations++;
+            #endif //MEDIAINFO_ADVANCED
             memcpy_Unaligned_Unaligned(Buffer_Temp, Old, Buffer_Temp_Size);
             delete[] Old; //Old=NULL;
         }
@@ -1209,6 +1369,9 @@ void File__Analyze::Open_Buffer_Continue (const int8u* ToAdd, size_t ToAdd_Size)
                     if (Buffer_Temp_Size_Max_ToAdd<Buffer_Temp_Size_Max) Buffer_Temp_Size_Max_ToAdd=Buffer_Temp_Size_Max;
                     Buffer_Temp_Size_Max=Buffer_Temp_Size_Max_ToAdd;
                     Buffer_Temp=new int8u[Buffer_Temp_Size_Max];
+                    #if MEDIAINFO_ADVANCED
+                        Profile_Buffer_Reallocations++;
+                    #endif //MEDIAINFO_ADVANCED
                 }
                 Buffer_Temp_Size=Buffer_Size-Buffer_Offset;
                 memcpy_Unaligned_Unaligned(Buffer_Temp, Buffer+Buffer_Offset, Buffer_Temp_Size);
@@ -1538,6 +1701,9 @@ bool File__Analyze::Open_Buffer_Continue_Loop ()
                 if (Buffer_Temp_Size_Max_ToAdd<Buffer_Temp_Size_Max) Buffer_Temp_Size_Max_ToAdd=Buffer_Temp_Size_Max;
                 Buffer_Temp_Size_Max=Buffer_Temp_Size_Max_ToAdd;
                 Buffer_Temp=new int8u[Buffer_Temp_Size_Max];
+                #if MEDIAINFO_ADVANCED
+                    Profile_Buffer_Reallocations++;
+                #endif //MEDIAINFO_ADVANCED
             }
             memcpy_Unaligned_Unaligned(Buffer_Temp, Buffer+Buffer_Size-Buffer_Temp_Size, Buffer_Temp_Size);
         }
@@ -1610,6 +1776,56 @@ void File__Analyze::Open_Buffer_Position_Set (int64u File_Offset_)
     File_GoTo=(int64u)-1;
 }
 
+//---------------------------------------------------------------------------
+#if MEDIAINFO_FINGERPRINT
+bool File__Analyze::Fingerprint_Continue ()
+{
+    if (!Fingerprint)
+        return false;
+
+    int64u Next=Fingerprint->Next();
+    if (Next==(int64u)-1)
+    {
+        Fill(Stream_General, 0, "Fingerprint_Generated", Fingerprint->Generate());
+        Fill_SetOptions(Stream_General, 0, "Fingerprint_Generated", "N NT");
+        delete Fingerprint; Fingerprint=NULL;
+        return false;
+    }
+
+    if (!Status[IsFinished])
+    {
+        //Blocks on the way of the parser are sampled when they come
+        if (!Status[IsAccepted] || File_GoTo!=(int64u)-1 || File_Offset+Buffer_Size<File_Size)
+            return false;
+
+        //The parser read up to the end of the file, finishing it now so we can jump back
+        if (!Open_Buffer_Finishing())
+            return false;
+        ForceFinish();
+    }
+
+    //From now only sampled blocks are read, the parser does not need the buffer anymore
+    if (Buffer_Size)
+    {
+        File_Offset+=Buffer_Size;
+        Buffer_Size=0;
+        Buffer_Offset=0;
+        delete[] Buffer_Temp; Buffer_Temp=NULL;
+        Buffer_Temp_Size=0;
+    }
+
+    if (Next<File_Offset && !Config->File_IsSeekable_Get())
+    {
+        //Missing blocks are behind
+        delete Fingerprint; Fingerprint=NULL;
+        return false;
+    }
+
+    File_GoTo=(Next==File_Offset || !Config->File_IsSeekable_Get())?(int64u)-1:Next;
+    return true;
+}
+#endif //MEDIAINFO_FINGERPRINT
+
 //---------------------------------------------------------------------------
 void File__Analyze::Open_Buffer_CheckFileModifications()
 {
@@ -1691,22 +1907,13 @@ void File__Analyze::Open_Buffer_Update ()
 //---------------------------------------------------------------------------
 void File__Analyze::Open_Buffer_Finalize (bool NoBufferModification)
 {
+    #if MEDIAINFO_ADVANCED
+        File__Analyze_Profile Profile_Scope(this);
+    #endif //MEDIAINFO_ADVANCED
+
     //Indication to the parser that this is finishing
-    if (!NoBufferModification && !Config->IsFinishing)
-    {
-        Config->IsFinishing=true;
-        int64u FileSize_Real=File_Size;
-        File_Size=File_Offset+Buffer_Size;
-        Open_Buffer_Continue((const int8u*)NULL, 0);
-        File_Size=FileSize_Real;
-        #if MEDIAINFO_DEMUX
-            if (Config->Demux_EventWasSent)
-            {
-                Config->IsFinishing=false; // Need to parse again
-                return;
-            }
-        #endif //MEDIAINFO_DEMUX
-    }
+    if (!NoBufferModification && !Config->IsFinishing && !Open_Buffer_Finishing())
+        return;
 
     //Element must be Finish
     while (Element_Level>0)
@@ -1726,7 +1933,12 @@ void File__Analyze::Open_Buffer_Finalize (bool NoBufferModification)
 
     #if MEDIAINFO_TRACE
     if (Details && Details->empty())
+    {
+        #if MEDIAINFO_EVENTS
+            Details_Flush();
+        #endif //MEDIAINFO_EVENTS
         Element[0].TraceNode.Print(Config_Trace_Format, *Details, Config_LineSeparator.To_UTF8(), File_Size);
+    }
     #endif //MEDIAINFO_TRACE
 
     #if MEDIAINFO_EVENTS
@@ -1750,6 +1962,27 @@ void File__Analyze::Open_Buffer_Finalize (bool NoBufferModification)
     #endif //MEDIAINFO_EVENTS
 }
 
+//---------------------------------------------------------------------------
+bool File__Analyze::Open_Buffer_Finishing ()
+{
+    //Indication to the parser that this is finishing, the file ends with the current buffer
+    Config->IsFinishing=true;
+    int64u FileSize_Real=File_Size;
+    File_Size=File_Offset+Buffer_Size;
+    Open_Buffer_Continue((const int8u*)NULL, 0);
+    File_Size=FileSize_Real;
+    #if MEDIAINFO_DEMUX
+        if (Config->Demux_EventWasSent)
+        {
+            Config->IsFinishing=false; // Need to parse again
+            return false;
+        }
+    #endif //MEDIAINFO_DEMUX
+
+    return true;
+}
+
+//---------------------------------------------------------------------------
 void File__Analyze::Open_Buffer_Finalize (File__Analyze* Sub)
 {
     if (Sub==NULL)
@@ -1760,6 +1993,43 @@ void File__Analyze::Open_Buffer_Finalize (File__Analyze* Sub)
     Sub->Open_Buffer_Finalize();
 }
 
+//---------------------------------------------------------------------------
+#if MEDIAINFO_ADVANCED
+void File__Analyze::Profile_Flush()
+{
+    if (!Profile_IsActive || !Config)
+        return;
+
+    //Name, the one of the parser if known else the detected format
+    string Name=ParserName;
+    for (size_t StreamKind=Stream_General; Name.empty() && StreamKind<Stream_Max; StreamKind++)
+        if (Count_Get((stream_t)StreamKind))
+            Name=Retrieve_Const((stream_t)StreamKind, 0, Fill_Parameter((stream_t)StreamKind, Generic_Format)).To_UTF8();
+    if (Name.empty())
+        Name="Unknown";
+
+    MediaInfo_Config_MediaInfo::parser_profile ToAdd;
+    ToAdd.Instances=Profile_IsFlushed?0:1;
+    ToAdd.Calls=Profile_Calls;
+    ToAdd.Time_Wall=Profile_Time_Wall;
+    ToAdd.Time_CPU=Profile_Time_CPU;
+    ToAdd.Bytes=Profile_Bytes;
+    ToAdd.Seeks=Profile_Seeks;
+    ToAdd.Buffer_Reallocations=Profile_Buffer_Reallocations;
+    ToAdd.SubParsers=Profile_SubParsers;
+    Config->Profile_Add(Name, ToAdd);
+
+    Profile_IsFlushed=true;
+    Profile_Calls=0;
+    Profile_Time_Wall=0;
+    Profile_Time_CPU=0;
+    Profile_Bytes=0;
+    Profile_Seeks=0;
+    Profile_Buffer_Reallocations=0;
+    Profile_SubParsers=0;
+}
+#endif //MEDIAINFO_ADVANCED
+
 //***************************************************************************
 // Buffer
 //***************************************************************************
@@ -2000,20 +2270,169 @@ void File__Analyze::Buffer_Clear()
 //***************************************************************************
 
 //---------------------------------------------------------------------------
-bool File__Analyze::Synchronize_0x000001()
+// Returns the first offset in [Begin, End) with a 0x000001 start code fully
+// inside the buffer. If there is none, returns the first offset which may
+// still begin a start code once more data is available.
+size_t File__Analyze::Find_StartCode(const int8u* Buffer, size_t Begin, size_t End)
+{
+    if (Begin+3>End)
+        return Begin;
+    size_t Last=End-2; //Candidates are in [Begin, Last)
+    size_t Pos=Begin;
+
+    #if defined(MEDIAINFO_FIND_SSE2)
+        //16 candidates per step, zero bytes are then checked one by one
+        const __m128i Zero=_mm_setzero_si128();
+        while (Pos+16<=Last)
+        {
+            int Mask=_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(Buffer+Pos)), Zero));
+            while (Mask)
+            {
+                #if defined(_MSC_VER)
+                    unsigned long Bit;
+                    _BitScanForward(&Bit, (unsigned long)Mask);
+                #else //defined(_MSC_VER)
+                    int Bit=__builtin_ctz((unsigned int)Mask);
+                #endif //defined(_MSC_VER)
+                size_t Candidate=Pos+Bit;
+                if (Buffer[Candidate+1]==0x00 && Buffer[Candidate+2]==0x01)
+                    return Candidate;
+                Mask&=Mask-1;
+            }
+            Pos+=16;
+        }
+    #elif defined(MEDIAINFO_FIND_NEON)
+        //16 candidates per step, blocks without zero byte are skipped
+        while (Pos+16<=Last)
+        {
+            if (vmaxvq_u8(vceqzq_u8(vld1q_u8(Buffer+Pos))))
+            {
+                for (size_t Candidate=Pos; Candidate<Pos+16; Candidate++)
+                    if (!Buffer[Candidate] && !Buffer[Candidate+1] && Buffer[Candidate+2]==0x01)
+                        return Candidate;
+            }
+            Pos+=16;
+        }
+    #else
+        //8 candidates per step, blocks without zero byte are skipped
+        while (Pos+8<=Last)
+        {
+            int64u Value;
+            std::memcpy(&Value, Buffer+Pos, 8);
+            if ((Value-0x0101010101010101LL)&~Value&0x8080808080808080LL)
+            {
+                for (size_t Candidate=Pos; Candidate<Pos+8; Candidate++)
+                    if (!Buffer[Candidate] && !Buffer[Candidate+1] && Buffer[Candidate+2]==0x01)
+                        return Candidate;
+            }
+            Pos+=8;
+        }
+    #endif
+
+    //Remaining bytes
+    for (; Pos<Last; Pos++)
+        if (!Buffer[Pos] && !Buffer[Pos+1] && Buffer[Pos+2]==0x01)
+            return Pos;
+
+    return Last;
+}
+
+//---------------------------------------------------------------------------
+size_t File__Analyze::Find_Byte(const int8u* Buffer, size_t Begin, size_t End, int8u Value)
 {
-    //Synchronizing
-    while(Buffer_Offset+3<=Buffer_Size && (Buffer[Buffer_Offset  ]!=0x00
-                                        || Buffer[Buffer_Offset+1]!=0x00
-                                        || Buffer[Buffer_Offset+2]!=0x01))
+    if (Begin>=End)
+        return Begin;
+    const void* Found=std::memchr(Buffer+Begin, Value, End-Begin);
+    return Found?((const int8u*)Found-Buffer):End;
+}
+
+//---------------------------------------------------------------------------
+// Used for sync words repeated at a fixed interval (e.g. MPEG-TS packets):
+// 16 candidate offsets are tested at once, a block of candidates is dropped
+// as soon as one of the repetitions does not match.
+// Caller must ensure that Pos+Offset+(Count-1)*Stride is in the buffer for
+// all Pos in [Begin, End).
+size_t File__Analyze::Find_Byte_Strided(const int8u* Buffer, size_t Begin, size_t End, size_t Offset, size_t Stride, size_t Count, int8u Value)
+{
+    size_t Pos=Begin;
+
+    #if defined(MEDIAINFO_FIND_SSE2)
+        const __m128i Pattern=_mm_set1_epi8((char)Value);
+        while (Pos+16<=End)
+        {
+            int Mask=0xFFFF;
+            for (size_t n=0; Mask && n<Count; n++)
+                Mask&=_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(Buffer+Pos+Offset+n*Stride)), Pattern));
+            if (Mask)
+            {
+                #if defined(_MSC_VER)
+                    unsigned long Bit;
+                    _BitScanForward(&Bit, (unsigned long)Mask);
+                #else //defined(_MSC_VER)
+                    int Bit=__builtin_ctz((unsigned int)Mask);
+                #endif //defined(_MSC_VER)
+                return Pos+Bit;
+            }
+            Pos+=16;
+        }
+    #elif defined(MEDIAINFO_FIND_NEON)
+        const uint8x16_t Pattern=vdupq_n_u8(Value);
+        while (Pos+16<=End)
+        {
+            uint8x16_t Mask=vdupq_n_u8(0xFF);
+            for (size_t n=0; n<Count; n++)
+            {
+                Mask=vandq_u8(Mask, vceqq_u8(vld1q_u8(Buffer+Pos+Offset+n*Stride), Pattern));
+                if (!vmaxvq_u8(Mask))
+                    break;
+            }
+            if (vmaxvq_u8(Mask))
+            {
+                uint8_t Lanes[16];
+                vst1q_u8(Lanes, Mask);
+                for (size_t i=0; i<16; i++)
+                    if (Lanes[i])
+                        return Pos+i;
+            }
+            Pos+=16;
+        }
+    #else
+        const int64u Pattern=0x0101010101010101LL*Value;
+        while (Pos+8<=End)
+        {
+            int64u Mask=0x8080808080808080LL;
+            for (size_t n=0; Mask && n<Count; n++)
+            {
+                int64u Word;
+                std::memcpy(&Word, Buffer+Pos+Offset+n*Stride, 8);
+                Word^=Pattern; //Matching bytes are now 0x00
+                Mask&=~(((Word&0x7F7F7F7F7F7F7F7FLL)+0x7F7F7F7F7F7F7F7FLL)|Word|0x7F7F7F7F7F7F7F7FLL);
+            }
+            if (Mask)
+                break; //At least one of these 8 candidates is good, the first one is found below
+            Pos+=8;
+        }
+    #endif
+
+    //Remaining candidates
+    for (; Pos<End; Pos++)
     {
-        Buffer_Offset+=2;
-        while(Buffer_Offset<Buffer_Size && Buffer[Buffer_Offset]!=0x00)
-            Buffer_Offset+=2;
-        if ((Buffer_Offset<Buffer_Size && Buffer[Buffer_Offset-1]==0x00) || Buffer_Offset>=Buffer_Size)
-            Buffer_Offset--;
+        size_t n=0;
+        while (n<Count && Buffer[Pos+Offset+n*Stride]==Value)
+            n++;
+        if (n==Count)
+            return Pos;
     }
 
+    return End;
+}
+
+//---------------------------------------------------------------------------
+bool File__Analyze::Synchronize_0x000001()
+{
+    //Synchronizing
+    Buffer_Offset=Find_StartCode(Buffer, Buffer_Offset, Buffer_Size);
+
     //Parsing last bytes if needed
     if (Buffer_Offset+3==Buffer_Size && (Buffer[Buffer_Offset  ]!=0x00
                                       || Buffer[Buffer_Offset+1]!=0x00
@@ -3085,7 +3504,7 @@ void File__Analyze::Element_Begin()
     Element[Element_Level].TraceNode.Init();
     Element[Element_Level].TraceNode.Pos=File_Offset+Buffer_Offset+Element_Offset+BS->OffsetBeforeLastCall_Get(); //TODO: change this, used in Element_End0()
     if (Trace_Activated)
-        Element[Element_Level].TraceNode.Size=Element[Element_Level].Next-(File_Offset+Buffer_Offset+Element_Offset+BS->OffsetBeforeLastCall_Get());
+        Element[Element_Level].TraceNode.Size=Element[Element_Level].Next-Element[Element_Level].TraceNode.Pos;
     #endif //MEDIAINFO_TRACE
 }
 
@@ -3108,7 +3527,7 @@ void File__Analyze::Element_Begin(const Ztring &Name)
     Element[Element_Level].TraceNode.Pos=File_Offset+Buffer_Offset+Element_Offset+BS->OffsetBeforeLastCall_Get(); //TODO: change this, used in Element_End0()
     if (Trace_Activated)
     {
-        Element[Element_Level].TraceNode.Size=Element[Element_Level].Next-(File_Offset+Buffer_Offset+Element_Offset+BS->OffsetBeforeLastCall_Get());
+        Element[Element_Level].TraceNode.Size=Element[Element_Level].Next-Element[Element_Level].TraceNode.Pos;
         Element_Name(Name);
     }
 }
@@ -3287,7 +3706,7 @@ void File__Analyze::Element_End_Common_Flush()
 {
     #if MEDIAINFO_TRACE
     //Size if not filled
-    if (File_Offset+Buffer_Offset+Element_Offset+(BS_Size-BS->Remain())/8<Element[Element_Level].Next)
+    if (Trace_Activated && File_Offset+Buffer_Offset+Element_Offset+(BS_Size-BS->Remain())/8<Element[Element_Level].Next)
         Element[Element_Level].TraceNode.Size=File_Offset+Buffer_Offset+Element_Offset+(BS_Size-BS->Remain())/8-Element[Element_Level].TraceNode.Pos;
     #endif //MEDIAINFO_TRACE
 
@@ -3912,6 +4331,20 @@ void File__Analyze::GoToFromEnd (int64u GoToFromEnd)
 }
 #endif //MEDIAINFO_TRACE
 
+//---------------------------------------------------------------------------
+#if MEDIAINFO_PREFETCH
+void File__Analyze::Prefetch (int64u Offset, int64u Size)
+{
+    //Only the top level parser knows real file offsets
+    if (IsSub || File_Size==(int64u)-1 || Offset>=File_Size || !Size)
+        return;
+
+    if (Size>File_Size-Offset)
+        Size=File_Size-Offset;
+    Config->File_Prefetch_Hints.push_back(std::make_pair(Offset, Size));
+}
+#endif //MEDIAINFO_PREFETCH
+
 //---------------------------------------------------------------------------
 int64u File__Analyze::Element_Code_Get (size_t Level)
 {
@@ -4161,6 +4594,34 @@ void File__Analyze::Details_Clear()
 }
 #endif //MEDIAINFO_TRACE
 
+//---------------------------------------------------------------------------
+#if MEDIAINFO_TRACE
+void File__Analyze::Details_Flush()
+{
+    #if MEDIAINFO_EVENTS
+        //Only top level elements of the main parser are complete, and only trace is output before the end of parsing
+        if (IsSub || !Trace_Activated || Element_Level || !Details || !Details->empty() || !Config->Inform_CallBackFunction_IsSet() || MediaInfoLib::Config.Inform_Get()==__T("MAXML"))
+            return;
+        element_details::Element_Node& Root=Element[0].TraceNode;
+        if (Root.Children.empty() || !Root.Name_Is_Empty() || Root.IsCat || Root.NoShow || !Root.OwnChildren)
+            return;
+
+        //Printing each child alone is same as printing the unnamed root
+        Inform_Sink Sink(*Config);
+        std::ostream Out(&Sink);
+        string LineSeparator=Config_LineSeparator.To_UTF8();
+        for (size_t Pos=0; Pos<Root.Children.size(); Pos++)
+        {
+            if (!Root.Children[Pos])
+                continue;
+            Root.Children[Pos]->Print(Config_Trace_Format, Out, LineSeparator, File_Size);
+            delete Root.Children[Pos];
+        }
+        Root.Children.clear();
+    #endif //MEDIAINFO_EVENTS
+}
+#endif //MEDIAINFO_TRACE
+
 #if MEDIAINFO_EVENTS
 void File__Analyze::Event_Prepare(struct MediaInfo_Event_Generic* Event, int32u Event_Code, size_t Event_Size)
 {
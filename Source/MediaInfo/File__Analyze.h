@@ -15,6 +15,9 @@
 #include "MediaInfo/File__Analyze_Element.h"
 #include "ZenLib/BitStream_Fast.h"
 #include "ZenLib/BitStream_LE.h"
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
 #if MEDIAINFO_IBIUSAGE
     #include "MediaInfo/Multiple/File_Ibi_Creation.h"
 #endif //MEDIAINFO_IBIUSAGE
@@ -88,6 +91,59 @@ static inline int8u ReverseBits(int8u c)
     return c;
 }
 
+//---------------------------------------------------------------------------
+// Count of leading zero bits, Value must not be 0
+static inline int8u CountLeadingZeros(int64u Value)
+{
+    #if defined(__GNUC__) || defined(__clang__)
+        return (int8u)__builtin_clzll(Value);
+    #elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+        unsigned long Index;
+        _BitScanReverse64(&Index, Value);
+        return (int8u)(63-Index);
+    #else
+        int8u Count=0;
+        if (!(Value>>32)) {Count+=32; Value<<=32;}
+        if (!(Value>>48)) {Count+=16; Value<<=16;}
+        if (!(Value>>56)) {Count+= 8; Value<<= 8;}
+        if (!(Value>>60)) {Count+= 4; Value<<= 4;}
+        if (!(Value>>62)) {Count+= 2; Value<<= 2;}
+        if (!(Value>>63)) {Count+= 1;}
+        return Count;
+    #endif
+}
+
+//---------------------------------------------------------------------------
+// Exp-Golomb code, returns the count of leading zero bits
+// The whole code is read at once when it fits in a 64-bit window
+static inline int8u Get_ExpGolomb(BitStream_Fast* BS, int64u &CodeNum)
+{
+    size_t Remain=BS->Remain();
+    int8u Window_Size=Remain<64?(int8u)Remain:64;
+    int64u Window=Window_Size?BS->Peek8(Window_Size):0;
+    if (!Window)
+    {
+        //No 1 bit in the window, the code is invalid or truncated
+        BS->Skip(Window_Size);
+        CodeNum=(Window_Size<=32)?((((int64u)1)<<Window_Size)-1+BS->Get4(Window_Size)):0;
+        return Window_Size;
+    }
+
+    int8u LeadingZeroBits=CountLeadingZeros(Window)-(64-Window_Size);
+    int8u Code_Size=(LeadingZeroBits<<1)+1;
+    if (Code_Size<=Window_Size)
+    {
+        CodeNum=(Window>>(Window_Size-Code_Size))-1;
+        BS->Skip(Code_Size);
+    }
+    else
+    {
+        BS->Skip(LeadingZeroBits+1);
+        CodeNum=(LeadingZeroBits<=32)?((((int64u)1)<<LeadingZeroBits)-1+BS->Get4(LeadingZeroBits)):0;
+    }
+    return LeadingZeroBits;
+}
+
 string uint128toString(uint128 Value, int radix);
 
 enum conformance_type {
@@ -141,6 +197,7 @@ public :
     void    Open_Buffer_Update      (File__Analyze* Sub);
     void    Open_Buffer_Unsynch     ();
     void    Open_Buffer_Finalize    (bool NoBufferModification=false);
+    bool    Open_Buffer_Finishing   (); //Parses the remaining buffer as the end of the file, false if a demux event interrupted it
     void    Open_Buffer_Finalize    (File__Analyze* Sub);
 
     //***************************************************************************
@@ -149,6 +206,18 @@ public :
 
     //In
     std::string ParserName;
+    #if MEDIAINFO_ADVANCED
+        bool    Profile_IsActive;
+        bool    Profile_IsFlushed;
+        int64u  Profile_Calls;
+        int64u  Profile_Time_Wall;
+        int64u  Profile_Time_CPU;
+        int64u  Profile_Bytes;
+        int64u  Profile_Seeks;
+        int64u  Profile_Buffer_Reallocations;
+        int64u  Profile_SubParsers;
+        void    Profile_Flush();
+    #endif //MEDIAINFO_ADVANCED
     #if MEDIAINFO_EVENTS
         size_t  StreamIDs_Size;
         int64u  StreamIDs[16];
@@ -404,14 +473,14 @@ protected :
 
     //Elements - Name
     void Element_Name (const Ztring &Name);
-    inline void Element_Name (const char*   Name) {Element_Name(Ztring().From_UTF8(Name));}
+    inline void Element_Name (const char*   Name) {if (Trace_Activated) Element_Name(Ztring().From_UTF8(Name));}
 
     //Elements - Info
 #if MEDIAINFO_TRACE
     template<typename T>
     void Element_Info (T Parameter, const char* Measure=NULL, int8u AfterComma=3)
     {
-        if (Config_Trace_Level<1)
+        if (!Trace_Activated || Config_Trace_Level<1)
             return;
 
         //Needed?
@@ -423,7 +492,7 @@ protected :
 
     void Element_Info (const char* Parameter, const char* Measure=NULL, int8u AfterComma=3)
     {
-        if (Config_Trace_Level<1)
+        if (!Trace_Activated || Config_Trace_Level<1)
             return;
 
         //Needed?
@@ -453,7 +522,7 @@ protected :
     //Elements - End
     inline void Element_End () {Element_End_Common_Flush();}
     void Element_End (const Ztring &Name);
-    inline void Element_End (const char *Name) {Element_End(Ztring().From_UTF8(Name));}
+    inline void Element_End (const char *Name) {if (Trace_Activated) Element_End(Ztring().From_UTF8(Name)); else Element_End_Common_Flush();}
     #define Element_End0() Element_End()
     #define Element_End1(_NAME) Element_End(_NAME)
     #define Element_Trace_End0() Element_End()
@@ -819,20 +888,25 @@ public :
         int8s   mapped_to2;
         int8s   mapped_to3;
     };
+    struct vlc_fast_entry
+    {
+        int32u      Pos;        //Index in Vlc, or start of the second level if Bits is 0
+        int8u       Bits;       //Code size, (int8u)-1 if no code
+    };
     struct vlc_fast
     {
-        int8u*      Array;
-        int8u*      BitsToSkip;
         const vlc*  Vlc;
-        int8u       Size;
+        int8u       Size;       //Longest code
+        int8u       Root_Size;  //Bits resolved by the first level
+        std::vector<vlc_fast_entry> Table;
     };
     #define VLC_END \
         {(int32u)-1, (int8u)-1, 0, 0, 0}
     static void Get_VL_Prepare(vlc_fast &Vlc);
     void Get_VL (const vlc Vlc[], size_t &Info, const char* Name);
-    void Get_VL (vlc_fast &Vlc, size_t &Info, const char* Name);
+    void Get_VL (const vlc_fast &Vlc, size_t &Info, const char* Name);
     void Skip_VL(const vlc Vlc[], const char* Name);
-    void Skip_VL(vlc_fast &Vlc, const char* Name);
+    void Skip_VL(const vlc_fast &Vlc, const char* Name);
     #define Info_VL(Vlc, Info, Name) size_t Info; Get_VL(Vlc, Info, Name)
 
     //***************************************************************************
@@ -1156,47 +1230,51 @@ public :
     size_t Stream_Prepare   (stream_t KindOfStream, size_t StreamPos=(size_t)-1);
     size_t Stream_Erase     (stream_t KindOfStream, size_t StreamPos);
 
+    //Fill with datas - Numbers, formatted without Ztring::ToZtring() stream conversion
+    static Ztring Fill_Number (int64u Value, int8u Radix=10);
+    static Ztring Fill_Number (int64s Value, int8u Radix=10);
+
     //Fill with datas (with parameter as a size_t)
     void Fill (stream_t StreamKind, size_t StreamPos, size_t Parameter, const Ztring  &Value, bool Replace=false);
     inline void Fill (stream_t StreamKind, size_t StreamPos, size_t Parameter, const std::string &Value, bool Utf8=true, bool Replace=false) {if (Utf8) Fill(StreamKind, StreamPos, Parameter, Ztring().From_UTF8(Value.c_str(), Value.size()), Replace); else Fill(StreamKind, StreamPos, Parameter, Ztring().From_Local(Value.c_str(), Value.size()), Replace);}
     inline void Fill (stream_t StreamKind, size_t StreamPos, size_t Parameter, const char*    Value, size_t Value_Size=Unlimited, bool Utf8=true, bool Replace=false) {if (Utf8) Fill(StreamKind, StreamPos, Parameter, Ztring().From_UTF8(Value, Value_Size), Replace); else Fill(StreamKind, StreamPos, Parameter, Ztring().From_Local(Value, Value_Size), Replace);}
     inline void Fill (stream_t StreamKind, size_t StreamPos, size_t Parameter, const wchar_t* Value, size_t Value_Size=Unlimited, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Ztring().From_Unicode(Value, Value_Size), Replace);}
-    inline void Fill (stream_t StreamKind, size_t StreamPos, size_t Parameter, int8u          Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Ztring::ToZtring(Value, Radix).MakeUpperCase(), Replace);}
-    inline void Fill (stream_t StreamKind, size_t StreamPos, size_t Parameter, int8s          Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Ztring::ToZtring(Value, Radix).MakeUpperCase(), Replace);}
-    inline void Fill (stream_t StreamKind, size_t StreamPos, size_t Parameter, int16u         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Ztring::ToZtring(Value, Radix).MakeUpperCase(), Replace);}
-    inline void Fill (stream_t StreamKind, size_t StreamPos, size_t Parameter, int16s         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Ztring::ToZtring(Value, Radix).MakeUpperCase(), Replace);}
-    inline void Fill (stream_t StreamKind, size_t StreamPos, size_t Parameter, int32u         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Ztring::ToZtring(Value, Radix).MakeUpperCase(), Replace);}
-    inline void Fill (stream_t StreamKind, size_t StreamPos, size_t Parameter, int32s         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Ztring::ToZtring(Value, Radix).MakeUpperCase(), Replace);}
-    inline void Fill (stream_t StreamKind, size_t StreamPos, size_t Parameter, int64u         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Ztring::ToZtring(Value, Radix).MakeUpperCase(), Replace);}
-    inline void Fill (stream_t StreamKind, size_t StreamPos, size_t Parameter, int64s         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Ztring::ToZtring(Value, Radix).MakeUpperCase(), Replace);}
+    inline void Fill (stream_t StreamKind, size_t StreamPos, size_t Parameter, int8u          Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Fill_Number((int64u)Value, Radix), Replace);}
+    inline void Fill (stream_t StreamKind, size_t StreamPos, size_t Parameter, int8s          Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Radix==10?Fill_Number((int64s)Value):Ztring::ToZtring(Value, Radix).MakeUpperCase(), Replace);}
+    inline void Fill (stream_t StreamKind, size_t StreamPos, size_t Parameter, int16u         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Fill_Number((int64u)Value, Radix), Replace);}
+    inline void Fill (stream_t StreamKind, size_t StreamPos, size_t Parameter, int16s         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Radix==10?Fill_Number((int64s)Value):Ztring::ToZtring(Value, Radix).MakeUpperCase(), Replace);}
+    inline void Fill (stream_t StreamKind, size_t StreamPos, size_t Parameter, int32u         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Fill_Number((int64u)Value, Radix), Replace);}
+    inline void Fill (stream_t StreamKind, size_t StreamPos, size_t Parameter, int32s         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Radix==10?Fill_Number((int64s)Value):Ztring::ToZtring(Value, Radix).MakeUpperCase(), Replace);}
+    inline void Fill (stream_t StreamKind, size_t StreamPos, size_t Parameter, int64u         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Fill_Number((int64u)Value, Radix), Replace);}
+    inline void Fill (stream_t StreamKind, size_t StreamPos, size_t Parameter, int64s         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Fill_Number((int64s)Value, Radix), Replace);}
            void Fill (stream_t StreamKind, size_t StreamPos, size_t Parameter, float64        Value, int8u AfterComma=3, bool Replace=false);
     #ifdef SIZE_T_IS_LONG
-    inline void Fill (stream_t StreamKind, size_t StreamPos, size_t Parameter, size_t         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Ztring::ToZtring(Value, Radix).MakeUpperCase(), Replace);}
+    inline void Fill (stream_t StreamKind, size_t StreamPos, size_t Parameter, size_t         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Fill_Number((int64u)Value, Radix), Replace);}
     #endif //SIZE_T_IS_LONG
     //Fill with datas
     void Fill_Dup (stream_t StreamKind, size_t StreamPos, const char* Parameter, const Ztring  &Value, bool Replace=false);
     void Fill_Measure (stream_t StreamKind, size_t StreamPos, const char* Parameter, const Ztring  &Value, const Ztring& Measure, bool Replace=false);
     inline void Fill_Measure(stream_t StreamKind, size_t StreamPos, const char* Parameter, const string&  Value, const Ztring& Measure, bool Utf8=true, bool Replace=false) {Fill_Measure(StreamKind, StreamPos, Parameter, Ztring().From_UTF8(Value.c_str(), Value.size()), Measure, Replace);}
-    inline void Fill_Measure(stream_t StreamKind, size_t StreamPos, const char* Parameter, int            Value, const Ztring& Measure, int8u Radix=10, bool Replace=false) {Fill_Measure(StreamKind, StreamPos, Parameter, Ztring::ToZtring(Value, Radix).MakeUpperCase(), Measure, Replace);}
+    inline void Fill_Measure(stream_t StreamKind, size_t StreamPos, const char* Parameter, int            Value, const Ztring& Measure, int8u Radix=10, bool Replace=false) {Fill_Measure(StreamKind, StreamPos, Parameter, Radix==10?Fill_Number((int64s)Value):Ztring::ToZtring(Value, Radix).MakeUpperCase(), Measure, Replace);}
     inline void Fill_Measure(stream_t StreamKind, size_t StreamPos, const char* Parameter, float64        Value, const Ztring& Measure, int8u AfterComma=3, bool Replace=false) {Fill_Measure(StreamKind, StreamPos, Parameter, Ztring::ToZtring(Value, AfterComma), Measure, Replace);}
     void Fill (stream_t StreamKind, size_t StreamPos, const char* Parameter, const Ztring  &Value, bool Replace=false);
     void Fill (stream_t StreamKind, size_t StreamPos, const char* Parameter, ZtringList &Value, ZtringList& Id, bool Replace=false);
     inline void Fill (stream_t StreamKind, size_t StreamPos, const char* Parameter, const std::string &Value, bool Utf8=true, bool Replace=false) {if (Utf8) Fill(StreamKind, StreamPos, Parameter, Ztring().From_UTF8(Value.c_str(), Value.size()), Replace); else Fill(StreamKind, StreamPos, Parameter, Ztring().From_Local(Value.c_str(), Value.size()), Replace);}
     inline void Fill (stream_t StreamKind, size_t StreamPos, const char* Parameter, const char*    Value, size_t Value_Size=Unlimited, bool Utf8=true, bool Replace=false) {if (Utf8) Fill(StreamKind, StreamPos, Parameter, Ztring().From_UTF8(Value, Value_Size), Replace); else Fill(StreamKind, StreamPos, Parameter, Ztring().From_Local(Value, Value_Size), Replace);}
     inline void Fill (stream_t StreamKind, size_t StreamPos, const char* Parameter, const wchar_t* Value, size_t Value_Size=Unlimited, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Ztring().From_Unicode(Value, Value_Size), Replace);}
-    inline void Fill (stream_t StreamKind, size_t StreamPos, const char* Parameter, int8u          Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Ztring::ToZtring(Value, Radix).MakeUpperCase(), Replace);}
-    inline void Fill (stream_t StreamKind, size_t StreamPos, const char* Parameter, int8s          Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Ztring::ToZtring(Value, Radix).MakeUpperCase(), Replace);}
-    inline void Fill (stream_t StreamKind, size_t StreamPos, const char* Parameter, int16u         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Ztring::ToZtring(Value, Radix).MakeUpperCase(), Replace);}
-    inline void Fill (stream_t StreamKind, size_t StreamPos, const char* Parameter, int16s         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Ztring::ToZtring(Value, Radix).MakeUpperCase(), Replace);}
-    inline void Fill (stream_t StreamKind, size_t StreamPos, const char* Parameter, int32u         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Ztring::ToZtring(Value, Radix).MakeUpperCase(), Replace);}
-    inline void Fill (stream_t StreamKind, size_t StreamPos, const char* Parameter, int32s         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Ztring::ToZtring(Value, Radix).MakeUpperCase(), Replace);}
-    inline void Fill (stream_t StreamKind, size_t StreamPos, const char* Parameter, int64u         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Ztring::ToZtring(Value, Radix).MakeUpperCase(), Replace);}
-    inline void Fill (stream_t StreamKind, size_t StreamPos, const char* Parameter, int64s         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Ztring::ToZtring(Value, Radix).MakeUpperCase(), Replace);}
+    inline void Fill (stream_t StreamKind, size_t StreamPos, const char* Parameter, int8u          Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Fill_Number((int64u)Value, Radix), Replace);}
+    inline void Fill (stream_t StreamKind, size_t StreamPos, const char* Parameter, int8s          Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Radix==10?Fill_Number((int64s)Value):Ztring::ToZtring(Value, Radix).MakeUpperCase(), Replace);}
+    inline void Fill (stream_t StreamKind, size_t StreamPos, const char* Parameter, int16u         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Fill_Number((int64u)Value, Radix), Replace);}
+    inline void Fill (stream_t StreamKind, size_t StreamPos, const char* Parameter, int16s         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Radix==10?Fill_Number((int64s)Value):Ztring::ToZtring(Value, Radix).MakeUpperCase(), Replace);}
+    inline void Fill (stream_t StreamKind, size_t StreamPos, const char* Parameter, int32u         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Fill_Number((int64u)Value, Radix), Replace);}
+    inline void Fill (stream_t StreamKind, size_t StreamPos, const char* Parameter, int32s         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Radix==10?Fill_Number((int64s)Value):Ztring::ToZtring(Value, Radix).MakeUpperCase(), Replace);}
+    inline void Fill (stream_t StreamKind, size_t StreamPos, const char* Parameter, int64u         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Fill_Number((int64u)Value, Radix), Replace);}
+    inline void Fill (stream_t StreamKind, size_t StreamPos, const char* Parameter, int64s         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Fill_Number((int64s)Value, Radix), Replace);}
     inline void Fill (stream_t StreamKind, size_t StreamPos, const char* Parameter, float32        Value, int8u AfterComma=3, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Ztring::ToZtring(Value, AfterComma), Replace);}
     inline void Fill (stream_t StreamKind, size_t StreamPos, const char* Parameter, float64        Value, int8u AfterComma=3, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Ztring::ToZtring(Value, AfterComma), Replace);}
     inline void Fill (stream_t StreamKind, size_t StreamPos, const char* Parameter, float80        Value, int8u AfterComma=3, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Ztring::ToZtring(Value, AfterComma), Replace);}
     #ifdef SIZE_T_IS_LONG
-    inline void Fill (stream_t StreamKind, size_t StreamPos, const char* Parameter, size_t         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Ztring::ToZtring(Value, Radix).MakeUpperCase(), Replace);}
+    inline void Fill (stream_t StreamKind, size_t StreamPos, const char* Parameter, size_t         Value, int8u Radix=10, bool Replace=false) {Fill(StreamKind, StreamPos, Parameter, Fill_Number((int64u)Value, Radix), Replace);}
     #endif //SIZE_T_IS_LONG
     struct fill_temp_item
     {
@@ -1239,6 +1317,9 @@ public :
     void ForceFinish   (File__Analyze* Parser);
     void GoTo          (int64u GoTo, const char* ParserName=NULL);
     void GoToFromEnd   (int64u GoToFromEnd, const char* ParserName=NULL);
+    #if MEDIAINFO_PREFETCH
+    void Prefetch      (int64u Offset, int64u Size);
+    #endif //MEDIAINFO_PREFETCH
     int64u Element_Code_Get (size_t Level);
     int64u Element_TotalSize_Get (size_t LevelLess=0);
     bool Element_IsComplete_Get ();
@@ -1403,6 +1484,9 @@ protected :
     bool FileHeader_Begin_0x000001();
     bool FileHeader_Begin_XML(tinyxml2::XMLDocument &Document);
     bool Synchronize_0x000001();
+    static size_t Find_StartCode(const int8u* Buffer, size_t Begin, size_t End); //First 0x000001 in [Begin, End), else first offset to retest with more data
+    static size_t Find_Byte(const int8u* Buffer, size_t Begin, size_t End, int8u Value); //First Value in [Begin, End), else End
+    static size_t Find_Byte_Strided(const int8u* Buffer, size_t Begin, size_t End, size_t Offset, size_t Stride, size_t Count, int8u Value); //First Pos in [Begin, End) with Value at Pos+Offset+n*Stride for all n<Count, else End
 public:
     #if defined(MEDIAINFO_FILE_YES)
     void TestContinuousFileNames(size_t CountOfFiles=24, Ztring FileExtension=Ztring(), bool SkipComputeDelay=false);
@@ -1432,7 +1516,9 @@ public: //TO CHANGE
 public : //TO CHANGE
     int64u Header_Size;             //Size of the header of the current element
     Ztring Details_Get(size_t Level=0) { std::string str; if (Element[Level].TraceNode.Print(Config_Trace_Format, str, Config_LineSeparator.To_UTF8(), File_Size) < 0) return Ztring(); return Ztring().From_UTF8(str);}
+    int    Details_Print(std::ostream& Out, size_t Level=0) { return Element[Level].TraceNode.Print(Config_Trace_Format, Out, Config_LineSeparator.To_UTF8(), File_Size);}
     void   Details_Clear();
+    void   Details_Flush(); //Send completed top level elements to the Inform callback then free them
 protected :
     bool Trace_DoNotSave;
     bool Trace_Activated;
@@ -1547,6 +1633,12 @@ public :
         int64u              Hash_ParseUpTo;
     #endif //MEDIAINFO_HASH
 
+    //Fingerprint
+    #if MEDIAINFO_FINGERPRINT
+        HashFingerprint*    Fingerprint;
+        bool                Fingerprint_Continue(); //true if sampled blocks are still needed, File_GoTo is set to the next one
+    #endif //MEDIAINFO_FINGERPRINT
+
     #if MEDIAINFO_CONFORMANCE
         void*               Conformance_Data;
         void                Fill_Conformance(const char* Field, const char* Value, uint8_t Flags = {}, conformance_type Level = Conformance_Error, stream_t StreamKind = Stream_General, size_t StreamPos = 0);
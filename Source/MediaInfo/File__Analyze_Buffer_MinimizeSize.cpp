@@ -901,35 +901,29 @@ void File__Analyze::Skip_VS()
 void File__Analyze::Get_SE(int32s &Info)
 {
     INTEGRITY_SIZE_ATLEAST_BUFFER();
-    int8u LeadingZeroBits=0;
-    while(BS->Remain()>0 && !BS->GetB())
-        LeadingZeroBits++;
+    int64u CodeNum;
+    int8u LeadingZeroBits=Get_ExpGolomb(BS, CodeNum);
     INTEGRITY_INT(LeadingZeroBits<=32)
-    double InfoD=pow((float)2, (float)LeadingZeroBits)-1+BS->Get4(LeadingZeroBits);
-    INTEGRITY_INT(InfoD<int32u(-1))
-    Info=(int32s)(pow((double)-1, InfoD+1)*(int32u)ceil(InfoD/2));
+    INTEGRITY_INT(CodeNum<int32u(-1))
+    Info=(CodeNum&1)?(int32s)((CodeNum+1)>>1):-(int32s)(CodeNum>>1);
 }
 
 //---------------------------------------------------------------------------
 void File__Analyze::Get_UE(int32u &Info)
 {
     INTEGRITY_SIZE_ATLEAST_BUFFER();
-    int8u LeadingZeroBits=0;
-    while(BS->Remain()>0 && !BS->GetB())
-        LeadingZeroBits++;
+    int64u CodeNum;
+    int8u LeadingZeroBits=Get_ExpGolomb(BS, CodeNum);
     INTEGRITY_INT(LeadingZeroBits<=32)
-    double InfoD=pow((float)2, (float)LeadingZeroBits);
-    Info=(int32u)InfoD-1+BS->Get4(LeadingZeroBits);
+    Info=(int32u)CodeNum;
 }
 
 //---------------------------------------------------------------------------
 void File__Analyze::Skip_UE()
 {
     INTEGRITY(BS->Remain())
-    int8u LeadingZeroBits=0;
-    while(BS->Remain()>0 && !BS->GetB())
-        LeadingZeroBits++;
-    BS->Skip(LeadingZeroBits);
+    int64u CodeNum;
+    Get_ExpGolomb(BS, CodeNum);
 }
 
 //***************************************************************************
@@ -1038,30 +1032,44 @@ void File__Analyze::Skip_VL_(const vlc Vlc[])
 //---------------------------------------------------------------------------
 void File__Analyze::Get_VL_Prepare(vlc_fast &Vlc)
 {
-    Vlc.Array=new int8u[((size_t)1)<<Vlc.Size];
-    Vlc.BitsToSkip=new int8u[((size_t)1)<<Vlc.Size];
-    memset(Vlc.Array, 0xFF, ((size_t)1)<<Vlc.Size);
-    int8u  Increment=0;
-    int8u  Pos=0;
-    for(; ; Pos++)
+    //Two levels: the first Root_Size bits, then the remaining bits of the longest code if needed
+    Vlc.Root_Size=Vlc.Size<9?Vlc.Size:9;
+    int8u Sub_Size=Vlc.Size-Vlc.Root_Size;
+    int32u End=0;
+    while (Vlc.Vlc[End].bit_increment!=255)
+        End++;
+    vlc_fast_entry Error={End, (int8u)-1};
+    Vlc.Table.clear();
+    Vlc.Table.resize(((size_t)1)<<Vlc.Root_Size, Error);
+
+    int8u Increment=0;
+    for (int32u Pos=0; Pos<End; Pos++)
     {
-        if (Vlc.Vlc[Pos].bit_increment==255)
-            break;
         Increment+=Vlc.Vlc[Pos].bit_increment;
-        size_t Value = ((size_t)Vlc.Vlc[Pos].value) << (Vlc.Size - Increment);
-        size_t ToFill_Size=((size_t)1)<<(Vlc.Size-Increment);
-        for (size_t ToFill_Pos=0; ToFill_Pos<ToFill_Size; ToFill_Pos++)
+        vlc_fast_entry Code={Pos, Increment};
+        size_t Value=Vlc.Vlc[Pos].value;
+        size_t Base=0;
+        int8u Level_Size=Vlc.Root_Size;
+        int8u Code_Size=Increment;
+        if (Code_Size>Vlc.Root_Size)
         {
-            Vlc.Array[Value+ToFill_Pos]=Pos;
-            Vlc.BitsToSkip[Value+ToFill_Pos]=Increment;
+            size_t Root=Value>>(Code_Size-Vlc.Root_Size);
+            if (Vlc.Table[Root].Bits==(int8u)-1)
+            {
+                Vlc.Table[Root].Pos=(int32u)Vlc.Table.size();
+                Vlc.Table[Root].Bits=0;
+                Vlc.Table.resize(Vlc.Table.size()+(((size_t)1)<<Sub_Size), Error);
+            }
+            Base=Vlc.Table[Root].Pos;
+            Level_Size=Sub_Size;
+            Code_Size-=Vlc.Root_Size;
+            Value&=(((size_t)1)<<Code_Size)-1;
         }
+        size_t ToFill_Size=((size_t)1)<<(Level_Size-Code_Size);
+        Value<<=Level_Size-Code_Size;
+        for (size_t ToFill_Pos=0; ToFill_Pos<ToFill_Size; ToFill_Pos++)
+            Vlc.Table[Base+Value+ToFill_Pos]=Code;
     }
-    for (size_t Pos2=0; Pos2<(((size_t)1)<<Vlc.Size); Pos2++)
-        if (Vlc.Array[Pos2]==(int8u)-1)
-        {
-            Vlc.Array[Pos2]=Pos;
-            Vlc.BitsToSkip[Pos2]=(int8u)-1;
-        }
 }
 
 //---------------------------------------------------------------------------
@@ -1074,15 +1082,19 @@ void File__Analyze::Get_VL_(const vlc_fast &Vlc, size_t &Info)
     }
 
     int32u Value=BS->Peek4(Vlc.Size);
-    Info=Vlc.Array[Value];
+    int8u Sub_Size=Vlc.Size-Vlc.Root_Size;
+    const vlc_fast_entry* Entry=&Vlc.Table[Value>>Sub_Size];
+    if (!Entry->Bits)
+        Entry=&Vlc.Table[Entry->Pos+(Value&((((int32u)1)<<Sub_Size)-1))];
+    Info=Entry->Pos;
 
-    if (Vlc.BitsToSkip[Value]==(int8u)-1)
+    if (Entry->Bits==(int8u)-1)
     {
         Trusted_IsNot();
         return;
     }
 
-    BS->Skip(Vlc.BitsToSkip[Value]);
+    BS->Skip(Entry->Bits);
 }
 
 //---------------------------------------------------------------------------
@@ -1095,14 +1107,18 @@ void File__Analyze::Skip_VL_(const vlc_fast &Vlc)
     }
 
     int32u Value=BS->Peek4(Vlc.Size);
+    int8u Sub_Size=Vlc.Size-Vlc.Root_Size;
+    const vlc_fast_entry* Entry=&Vlc.Table[Value>>Sub_Size];
+    if (!Entry->Bits)
+        Entry=&Vlc.Table[Entry->Pos+(Value&((((int32u)1)<<Sub_Size)-1))];
 
-    if (Vlc.BitsToSkip[Value]==(int8u)-1)
+    if (Entry->Bits==(int8u)-1)
     {
         Trusted_IsNot();
         return;
     }
 
-    BS->Skip(Vlc.BitsToSkip[Value]);
+    BS->Skip(Entry->Bits);
 }
 
 //***************************************************************************
@@ -951,6 +951,15 @@ print_children:
 
 //---------------------------------------------------------------------------
 int element_details::Element_Node::Print(MediaInfo_Config::trace_Format Format, std::string& Str, const string& eol, int64u File_Size)
+{
+    std::ostringstream ss;
+    int ret = Print(Format, ss, eol, File_Size);
+    Str = ss.str();
+    return ret;
+}
+
+//---------------------------------------------------------------------------
+int element_details::Element_Node::Print(MediaInfo_Config::trace_Format Format, std::ostream& ss, const string& eol, int64u File_Size)
 {
     //Computing how many characters are needed for displaying maximum file size
     size_t offset_size = sizeof(File_Size)*8-1;
@@ -959,7 +968,6 @@ int element_details::Element_Node::Print(MediaInfo_Config::trace_Format Format,
     offset_size++;
     offset_size = (offset_size / 4) + ((offset_size % 4) ? 1 : 0); //4 bits per offset char
 
-    std::ostringstream ss;
     int ret = -1;
     print_struc s(ss, eol, offset_size);
     switch (Format)
@@ -979,7 +987,6 @@ int element_details::Element_Node::Print(MediaInfo_Config::trace_Format Format,
         default:
             break;
     }
-    Str = ss.str();
     return ret;
 }
 
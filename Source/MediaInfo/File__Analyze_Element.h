@@ -165,16 +165,17 @@ struct element_details
 
         // Print
         int  Print(MediaInfo_Config::trace_Format Format, std::string& str, const string& eol, int64u File_Size);  //Print the node into str
+        int  Print(MediaInfo_Config::trace_Format Format, std::ostream& os, const string& eol, int64u File_Size); //Print the node into os
 
     private:
         struct print_struc
         {
-            std::ostringstream& ss;
+            std::ostream& ss;
             const string eol;
             const size_t offset_size;
             size_t level;
 
-            print_struc(std::ostringstream& ss_, const string& eol_, size_t offset_size_)
+            print_struc(std::ostream& ss_, const string& eol_, size_t offset_size_)
                 :
                 ss(ss_),
                 eol(eol_),
@@ -1321,6 +1321,44 @@ size_t ShowSource_IsInList(video Value)
     return Offset;
 }
 
+//---------------------------------------------------------------------------
+static Ztring Fill_Number_Format (int64u Value, bool IsNegative, int8u Radix)
+{
+    Char Temp[66];
+    Char* End=Temp+66;
+    Char* Begin=End;
+    do
+    {
+        *--Begin=__T("0123456789ABCDEF")[Value%Radix];
+        Value/=Radix;
+    }
+    while (Value);
+    if (IsNegative)
+        *--Begin=__T('-');
+
+    Ztring ToReturn;
+    ToReturn.assign(Begin, End-Begin);
+    return ToReturn;
+}
+
+//---------------------------------------------------------------------------
+Ztring File__Analyze::Fill_Number (int64u Value, int8u Radix)
+{
+    if (Radix!=10 && Radix!=16) //Same output as Ztring::ToZtring() is checked only for these ones
+        return Ztring::ToZtring(Value, Radix).MakeUpperCase();
+    return Fill_Number_Format(Value, false, Radix);
+}
+
+//---------------------------------------------------------------------------
+Ztring File__Analyze::Fill_Number (int64s Value, int8u Radix)
+{
+    if (Radix!=10) //Negative values with other radix depend on the original type, callers keep Ztring::ToZtring() for them
+        return Ztring::ToZtring(Value, Radix).MakeUpperCase();
+    if (Value<0)
+        return Fill_Number_Format(((int64u)0)-(int64u)Value, true, Radix);
+    return Fill_Number_Format((int64u)Value, false, Radix);
+}
+
 //---------------------------------------------------------------------------
 void File__Analyze::Fill (stream_t StreamKind, size_t StreamPos, size_t Parameter, const Ztring &Value, bool Replace)
 {
@@ -2339,7 +2377,7 @@ void File__Analyze::Fill (stream_t StreamKind, size_t StreamPos, const char* Par
 
     //Handling of well known parameters
     const Ztring Parameter_Local = Ztring().From_UTF8(Parameter);
-    const size_t Pos=MediaInfoLib::Config.Info_Get(StreamKind).Find(Parameter_Local);
+    const size_t Pos=MediaInfoLib::Config.Info_Find(StreamKind, Parameter_Local);
     if (Pos!=Error)
     {
         Fill(StreamKind, StreamPos, Pos, Value, Replace);
@@ -2463,7 +2501,7 @@ void File__Analyze::Fill_SetOptions(stream_t StreamKind, size_t StreamPos, const
     }
 
     //Handling of well known parameters
-    size_t Pos=MediaInfoLib::Config.Info_Get(StreamKind).Find(Ztring().From_UTF8(Parameter));
+    size_t Pos=MediaInfoLib::Config.Info_Find(StreamKind, Ztring().From_UTF8(Parameter));
     if (Pos!=Error)
     {
         //We can not change that
@@ -2546,7 +2584,7 @@ const Ztring &File__Analyze::Retrieve_Const (stream_t StreamKind, size_t StreamP
     if (KindOfInfo!=Info_Text)
         return MediaInfoLib::Config.Info_Get(StreamKind, Parameter, KindOfInfo);
     const Ztring Parameter_Local = Ztring().From_UTF8(Parameter);
-    size_t Parameter_Pos=MediaInfoLib::Config.Info_Get(StreamKind).Find(Parameter_Local);
+    size_t Parameter_Pos=MediaInfoLib::Config.Info_Find(StreamKind, Parameter_Local);
     if (Parameter_Pos==Error)
     {
         if (StreamPos==(*Stream)[StreamKind].size())
@@ -2580,7 +2618,7 @@ Ztring File__Analyze::Retrieve (stream_t StreamKind, size_t StreamPos, const cha
     if (KindOfInfo!=Info_Text)
         return MediaInfoLib::Config.Info_Get(StreamKind, Parameter, KindOfInfo);
     const Ztring Parameter_Local = Ztring().From_UTF8(Parameter);
-    size_t Parameter_Pos=MediaInfoLib::Config.Info_Get(StreamKind).Find(Parameter_Local);
+    size_t Parameter_Pos=MediaInfoLib::Config.Info_Find(StreamKind, Parameter_Local);
     if (Parameter_Pos==Error)
     {
         Parameter_Pos=(*Stream_More)[StreamKind][StreamPos].Find(Parameter_Local);
@@ -2614,7 +2652,7 @@ void File__Analyze::Clear (stream_t StreamKind, size_t StreamPos, const char* Pa
         return;
     }
     const Ztring Parameter_Local = Ztring().From_UTF8(Parameter);
-    size_t Parameter_Pos=MediaInfoLib::Config.Info_Get(StreamKind).Find(Parameter_Local);
+    size_t Parameter_Pos=MediaInfoLib::Config.Info_Find(StreamKind, Parameter_Local);
     if (Parameter_Pos==Error)
     {
         Parameter_Pos=(*Stream_More)[StreamKind][StreamPos].Find(Parameter_Local);
@@ -164,7 +164,7 @@ const Ztring &File__Base::Get (stream_t StreamKind, size_t StreamPos, const Ztri
     //Check integrity
     if (StreamKind>=Stream_Max || StreamPos>=(*Stream)[StreamKind].size() || KindOfInfo>=Info_Max)
         return MediaInfoLib::Config.EmptyString_Get();
-    if ((ParameterI=MediaInfoLib::Config.Info_Get(StreamKind).Find(Parameter, KindOfSearch))==Error)
+    if ((ParameterI=(KindOfSearch==Info_Name?MediaInfoLib::Config.Info_Find(StreamKind, Parameter):MediaInfoLib::Config.Info_Get(StreamKind).Find(Parameter, KindOfSearch)))==Error)
     {
         ParameterI=(*Stream_More)[StreamKind][StreamPos].Find(Parameter, KindOfSearch);
         if (ParameterI==Error)
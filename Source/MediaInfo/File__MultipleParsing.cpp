@@ -421,6 +421,7 @@
     #include "MediaInfo/File_Other.h"
 #endif
 #include "MediaInfo/File_Unknown.h"
+#include <cstring>
 //---------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------
@@ -455,6 +456,25 @@ File__MultipleParsing::File__MultipleParsing()
         Trace_DoNotSave=true;
     #endif //MEDIAINFO_TRACE
 
+    //Temp
+    Parser_IsCreated=false;
+    Parser_IsFromSignature=false;
+}
+
+//---------------------------------------------------------------------------
+File__MultipleParsing::~File__MultipleParsing()
+{
+    for (size_t Pos=0; Pos<Parser.size(); Pos++)
+        delete Parser[Pos]; //Parser[Pos]=NULL
+}
+
+//***************************************************************************
+// Parsers
+//***************************************************************************
+
+//---------------------------------------------------------------------------
+void File__MultipleParsing::Parsers_Create()
+{
     // Multiple
     #if defined(MEDIAINFO_AAF_YES)
         Parser.push_back(new File_Aaf());
@@ -862,10 +882,250 @@ File__MultipleParsing::File__MultipleParsing()
 }
 
 //---------------------------------------------------------------------------
-File__MultipleParsing::~File__MultipleParsing()
+// Formats having a magic value at a fixed offset at the beginning of the file
+// Each entry creates all parsers of Parsers_Create() able to handle this magic value, in the same order,
+// so the first parser accepting the file is the same
+typedef void (*signature_create)(std::vector<File__Analyze*>& Parser);
+struct signature
 {
-    for (size_t Pos=0; Pos<Parser.size(); Pos++)
-        delete Parser[Pos]; //Parser[Pos]=NULL
+    size_t              Offset;
+    size_t              Size;
+    const char*         Value;
+    size_t              Repeat; //If not 0, value must also be present at Offset+Repeat and Offset+2*Repeat (packet based formats)
+    signature_create    Create;
+};
+
+#if defined(MEDIAINFO_BDAV_YES)
+    static void Signature_Bdav(std::vector<File__Analyze*>& Parser) {{File_MpegTs* Temp=new File_MpegTs(); Temp->BDAV_Size=4; Parser.push_back(Temp);}
+                                                                   {File_MpegTs* Temp=new File_MpegTs(); Temp->BDAV_Size=4; Temp->NoPatPmt=true; Parser.push_back(Temp);}}
+#endif
+#if defined(MEDIAINFO_FLV_YES)
+    static void Signature_Flv(std::vector<File__Analyze*>& Parser) {Parser.push_back(new File_Flv());}
+#endif
+#if defined(MEDIAINFO_IVF_YES)
+    static void Signature_Ivf(std::vector<File__Analyze*>& Parser) {Parser.push_back(new File_Ivf());}
+#endif
+#if defined(MEDIAINFO_MK_YES)
+    static void Signature_Mk(std::vector<File__Analyze*>& Parser) {Parser.push_back(new File_Mk());}
+#endif
+#if defined(MEDIAINFO_MPEG4_YES)
+    static void Signature_Mpeg4(std::vector<File__Analyze*>& Parser) {Parser.push_back(new File_Mpeg4());}
+#endif
+#if defined(MEDIAINFO_MPEGPS_YES)
+    static void Signature_MpegPs(std::vector<File__Analyze*>& Parser) {Parser.push_back(new File_MpegPs());}
+#endif
+#if defined(MEDIAINFO_MPEGTS_YES)
+    static void Signature_MpegTs(std::vector<File__Analyze*>& Parser) {Parser.push_back(new File_MpegTs());
+                                                                     {File_MpegTs* Temp=new File_MpegTs(); Temp->NoPatPmt=true; Parser.push_back(Temp);}}
+#endif
+#if defined(MEDIAINFO_MXF_YES)
+    static void Signature_Mxf(std::vector<File__Analyze*>& Parser) {Parser.push_back(new File_Mxf());}
+#endif
+#if defined(MEDIAINFO_OGG_YES)
+    static void Signature_Ogg(std::vector<File__Analyze*>& Parser) {Parser.push_back(new File_Ogg());}
+#endif
+#if defined(MEDIAINFO_CDXA_YES) || defined(MEDIAINFO_RIFF_YES) || defined(MEDIAINFO_WEBP_YES)
+    static void Signature_Riff(std::vector<File__Analyze*>& Parser)
+    {
+        #if defined(MEDIAINFO_CDXA_YES)
+            Parser.push_back(new File_Cdxa()); //RIFF....CDXA
+        #endif
+        #if defined(MEDIAINFO_RIFF_YES)
+            Parser.push_back(new File_Riff());
+        #endif
+        #if defined(MEDIAINFO_WEBP_YES)
+            Parser.push_back(new File_WebP()); //RIFF....WEBP
+        #endif
+        #if defined(MEDIAINFO_OTHER_YES)
+            Parser.push_back(new File_Other()); //RIFF....AMV
+        #endif
+    }
+#endif
+#if defined(MEDIAINFO_RM_YES)
+    static void Signature_Rm(std::vector<File__Analyze*>& Parser) {Parser.push_back(new File_Rm());}
+#endif
+#if defined(MEDIAINFO_WM_YES)
+    static void Signature_Wm(std::vector<File__Analyze*>& Parser) {Parser.push_back(new File_Wm());}
+#endif
+#if defined(MEDIAINFO_APE_YES)
+    static void Signature_Ape(std::vector<File__Analyze*>& Parser) {Parser.push_back(new File_Ape());}
+#endif
+#if defined(MEDIAINFO_CAF_YES)
+    static void Signature_Caf(std::vector<File__Analyze*>& Parser) {Parser.push_back(new File_Caf());}
+#endif
+#if defined(MEDIAINFO_FLAC_YES)
+    static void Signature_Flac(std::vector<File__Analyze*>& Parser) {Parser.push_back(new File_Flac());}
+#endif
+#if defined(MEDIAINFO_PDF_YES)
+    static void Signature_Pdf(std::vector<File__Analyze*>& Parser) {Parser.push_back(new File_Pdf());}
+#endif
+#if defined(MEDIAINFO_DPX_YES)
+    static void Signature_Dpx(std::vector<File__Analyze*>& Parser) {Parser.push_back(new File_Dpx());}
+#endif
+#if defined(MEDIAINFO_EXR_YES)
+    static void Signature_Exr(std::vector<File__Analyze*>& Parser) {Parser.push_back(new File_Exr());}
+#endif
+#if defined(MEDIAINFO_GIF_YES)
+    static void Signature_Gif(std::vector<File__Analyze*>& Parser) {Parser.push_back(new File_Gif());}
+#endif
+#if defined(MEDIAINFO_JPEG_YES)
+    static void Signature_Jpeg(std::vector<File__Analyze*>& Parser) {Parser.push_back(new File_Jpeg());}
+#endif
+#if defined(MEDIAINFO_PNG_YES)
+    static void Signature_Png(std::vector<File__Analyze*>& Parser) {Parser.push_back(new File_Png());}
+#endif
+#if defined(MEDIAINFO_TIFF_YES)
+    static void Signature_Tiff(std::vector<File__Analyze*>& Parser) {Parser.push_back(new File_Tiff());}
+#endif
+#if defined(MEDIAINFO_7Z_YES)
+    static void Signature_7z(std::vector<File__Analyze*>& Parser) {Parser.push_back(new File_7z());}
+#endif
+#if defined(MEDIAINFO_BZIP2_YES)
+    static void Signature_Bzip2(std::vector<File__Analyze*>& Parser) {Parser.push_back(new File_Bzip2());}
+#endif
+#if defined(MEDIAINFO_ELF_YES)
+    static void Signature_Elf(std::vector<File__Analyze*>& Parser) {Parser.push_back(new File_Elf());}
+#endif
+#if defined(MEDIAINFO_GZIP_YES)
+    static void Signature_Gzip(std::vector<File__Analyze*>& Parser) {Parser.push_back(new File_Gzip());}
+#endif
+#if defined(MEDIAINFO_RAR_YES)
+    static void Signature_Rar(std::vector<File__Analyze*>& Parser) {Parser.push_back(new File_Rar());}
+#endif
+#if defined(MEDIAINFO_ZIP_YES)
+    static void Signature_Zip(std::vector<File__Analyze*>& Parser) {Parser.push_back(new File_Zip());}
+#endif
+
+static const signature Signatures[]=
+{
+    #if defined(MEDIAINFO_BDAV_YES)
+        { 4, 1, "\x47", 192, Signature_Bdav},
+    #endif
+    #if defined(MEDIAINFO_FLV_YES)
+        { 0, 3, "FLV", 0, Signature_Flv},
+    #endif
+    #if defined(MEDIAINFO_IVF_YES)
+        { 0, 4, "DKIF", 0, Signature_Ivf},
+    #endif
+    #if defined(MEDIAINFO_MK_YES)
+        { 0, 4, "\x1A\x45\xDF\xA3", 0, Signature_Mk},
+    #endif
+    #if defined(MEDIAINFO_MPEG4_YES)
+        { 4, 4, "ftyp", 0, Signature_Mpeg4},
+        { 4, 4, "moov", 0, Signature_Mpeg4},
+        { 4, 4, "mdat", 0, Signature_Mpeg4},
+        { 4, 4, "free", 0, Signature_Mpeg4},
+        { 4, 4, "skip", 0, Signature_Mpeg4},
+        { 4, 4, "wide", 0, Signature_Mpeg4},
+        { 4, 4, "pnot", 0, Signature_Mpeg4},
+        { 4, 4, "jP  ", 0, Signature_Mpeg4},
+    #endif
+    #if defined(MEDIAINFO_MPEGPS_YES)
+        { 0, 4, "\x00\x00\x01\xBA", 0, Signature_MpegPs},
+    #endif
+    #if defined(MEDIAINFO_MPEGTS_YES)
+        { 0, 1, "\x47", 188, Signature_MpegTs},
+    #endif
+    #if defined(MEDIAINFO_MXF_YES)
+        { 0, 11, "\x06\x0E\x2B\x34\x02\x05\x01\x01\x0D\x01\x02", 0, Signature_Mxf},
+    #endif
+    #if defined(MEDIAINFO_OGG_YES)
+        { 0, 4, "OggS", 0, Signature_Ogg},
+    #endif
+    #if defined(MEDIAINFO_CDXA_YES) || defined(MEDIAINFO_RIFF_YES) || defined(MEDIAINFO_WEBP_YES)
+        { 0, 4, "RIFF", 0, Signature_Riff},
+        { 0, 4, "RF64", 0, Signature_Riff},
+        { 0, 4, "BW64", 0, Signature_Riff},
+        { 0, 4, "FORM", 0, Signature_Riff},
+    #endif
+    #if defined(MEDIAINFO_RM_YES)
+        { 0, 4, ".RMF", 0, Signature_Rm},
+    #endif
+    #if defined(MEDIAINFO_WM_YES)
+        { 0, 8, "\x30\x26\xB2\x75\x8E\x66\xCF\x11", 0, Signature_Wm},
+    #endif
+    #if defined(MEDIAINFO_APE_YES)
+        { 0, 3, "MAC", 0, Signature_Ape},
+    #endif
+    #if defined(MEDIAINFO_CAF_YES)
+        { 0, 4, "caff", 0, Signature_Caf},
+    #endif
+    #if defined(MEDIAINFO_FLAC_YES)
+        { 0, 4, "fLaC", 0, Signature_Flac},
+    #endif
+    #if defined(MEDIAINFO_PDF_YES)
+        { 0, 5, "%PDF-", 0, Signature_Pdf},
+    #endif
+    #if defined(MEDIAINFO_DPX_YES)
+        { 0, 4, "SDPX", 0, Signature_Dpx},
+        { 0, 4, "XPDS", 0, Signature_Dpx},
+    #endif
+    #if defined(MEDIAINFO_EXR_YES)
+        { 0, 4, "\x76\x2F\x31\x01", 0, Signature_Exr},
+    #endif
+    #if defined(MEDIAINFO_GIF_YES)
+        { 0, 4, "GIF8", 0, Signature_Gif},
+    #endif
+    #if defined(MEDIAINFO_JPEG_YES)
+        { 0, 3, "\xFF\xD8\xFF", 0, Signature_Jpeg},
+    #endif
+    #if defined(MEDIAINFO_PNG_YES)
+        { 0, 8, "\x89PNG\x0D\x0A\x1A\x0A", 0, Signature_Png},
+    #endif
+    #if defined(MEDIAINFO_TIFF_YES)
+        { 0, 4, "II*\x00", 0, Signature_Tiff},
+        { 0, 4, "MM\x00*", 0, Signature_Tiff},
+    #endif
+    #if defined(MEDIAINFO_7Z_YES)
+        { 0, 6, "7z\xBC\xAF\x27\x1C", 0, Signature_7z},
+    #endif
+    #if defined(MEDIAINFO_BZIP2_YES)
+        { 0, 3, "BZh", 0, Signature_Bzip2},
+    #endif
+    #if defined(MEDIAINFO_ELF_YES)
+        { 0, 4, "\x7F" "ELF", 0, Signature_Elf},
+    #endif
+    #if defined(MEDIAINFO_GZIP_YES)
+        { 0, 2, "\x1F\x8B", 0, Signature_Gzip},
+    #endif
+    #if defined(MEDIAINFO_RAR_YES)
+        { 0, 6, "Rar!\x1A\x07", 0, Signature_Rar},
+    #endif
+    #if defined(MEDIAINFO_ZIP_YES)
+        { 0, 4, "PK\x03\x04", 0, Signature_Zip},
+    #endif
+    { 0, 0, NULL, 0, NULL},
+};
+
+//---------------------------------------------------------------------------
+bool File__MultipleParsing::Parsers_Create_FromSignature()
+{
+    //Only from the beginning of the file
+    if (File_Offset+Buffer_Offset)
+        return false;
+
+    const int8u* Begin=Buffer+Buffer_Offset;
+    size_t Size=(size_t)Element_Size;
+    std::vector<signature_create> Creates;
+    for (const signature* Signature=Signatures; Signature->Create; Signature++)
+    {
+        bool IsFound=true;
+        for (size_t Pos=0; Pos<(Signature->Repeat?3:1) && IsFound; Pos++)
+        {
+            size_t Offset=Signature->Offset+Pos*Signature->Repeat;
+            if (Offset+Signature->Size>Size || memcmp(Begin+Offset, Signature->Value, Signature->Size))
+                IsFound=false;
+        }
+        if (IsFound && (Creates.empty() || Creates.back()!=Signature->Create))
+            Creates.push_back(Signature->Create);
+    }
+    if (Creates.empty())
+        return false;
+
+    for (size_t Pos=0; Pos<Creates.size(); Pos++)
+        Creates[Pos](Parser);
+    Parser_IsFromSignature=true;
+    return true;
 }
 
 //***************************************************************************
@@ -888,6 +1148,10 @@ void File__MultipleParsing::Streams_Finish()
 //---------------------------------------------------------------------------
 void File__MultipleParsing::Read_Buffer_Init()
 {
+    //Parsers are created with the first bytes
+    if (!Parser_IsCreated)
+        return;
+
     //Parsing
     for (size_t Pos=0; Pos<Parser.size(); Pos++)
     {
@@ -914,6 +1178,15 @@ void File__MultipleParsing::Read_Buffer_Unsynched()
 //---------------------------------------------------------------------------
 void File__MultipleParsing::Read_Buffer_Continue()
 {
+    //Parsers
+    if (!Parser_IsCreated)
+    {
+        Parser_IsCreated=true;
+        if (!Parsers_Create_FromSignature())
+            Parsers_Create();
+        Read_Buffer_Init();
+    }
+
     //Position if requested (reset of value after it was set in the previous call)
     if (Parser.size()==1 && Parser[0]->File_GoTo!=(int64u)-1)
         Parser[0]->File_GoTo=File_GoTo;
@@ -976,6 +1249,19 @@ void File__MultipleParsing::Read_Buffer_Continue()
         }
     }
 
+    if (Parser.empty() && Parser_IsFromSignature && !Status[IsAccepted])
+    {
+        //Magic value is found but the content is not accepted, testing with all parsers
+        Parser_IsFromSignature=false;
+        Parsers_Create();
+        Read_Buffer_Init();
+        if (File_Offset+Buffer_Offset)
+            File_GoTo=0;
+        else
+            Read_Buffer_Continue();
+        return;
+    }
+
     if (Parser.empty())
     {
         File__Analyze* Temp=new File_Unknown(); Parser.push_back(Temp);
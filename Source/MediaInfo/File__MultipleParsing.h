@@ -39,8 +39,14 @@ private :
     void Read_Buffer_Unsynched();
     void Read_Buffer_Continue();
 
+    //Parsers
+    void Parsers_Create();
+    bool Parsers_Create_FromSignature();
+
     //Temp
     std::vector<File__Analyze*> Parser;
+    bool Parser_IsCreated;
+    bool Parser_IsFromSignature;
 };
 
 } //NameSpace
@@ -43,6 +43,29 @@ using namespace ZenLib;
         #include <sha2.h>
     }
 #endif //MEDIAINFO_SHA2
+#if MEDIAINFO_XXH3
+    #define XXH_INLINE_ALL
+    #include "ThirdParty/xxhash/xxhash.h"
+#endif //MEDIAINFO_XXH3
+#if MEDIAINFO_CRC64
+    #if (defined(__GNUC__) && defined(__x86_64__)) || (defined(_MSC_VER) && defined(_M_X64))
+        #define MEDIAINFO_CRC64_CLMUL 1
+        #include <wmmintrin.h>
+        #if defined(_MSC_VER)
+            #include <intrin.h>
+        #endif
+    #else
+        #define MEDIAINFO_CRC64_CLMUL 0
+    #endif
+#endif //MEDIAINFO_CRC64
+#if MEDIAINFO_HASH_THREAD
+    #include <algorithm>
+    #include <condition_variable>
+    #include <cstring>
+    #include <deque>
+    #include <mutex>
+    #include <thread>
+#endif //MEDIAINFO_HASH_THREAD
 //---------------------------------------------------------------------------
 
 namespace MediaInfoLib
@@ -54,6 +77,317 @@ namespace MediaInfoLib
 
 static const char HashWrapper_Hex[16] = {'0','1','2','3','4','5','6','7','8','9','a','b','c','d','e','f'};
 
+//***************************************************************************
+// CRC-64
+//***************************************************************************
+
+#if MEDIAINFO_CRC64
+//---------------------------------------------------------------------------
+// CRC-64/XZ: ECMA-182 polynomial, reflected, init and xorout all ones
+// Context is the CRC before xorout
+static const int64u HashWrapper_Crc64_Polynomial=0xC96C5795D7870F42ULL;
+
+//---------------------------------------------------------------------------
+struct HashWrapper_Crc64_Tables
+{
+    int64u T[8][256]; //Slicing-by-8
+
+    HashWrapper_Crc64_Tables()
+    {
+        for (size_t i=0; i<256; ++i)
+        {
+            int64u Crc=i;
+            for (size_t j=0; j<8; ++j)
+                Crc=(Crc>>1)^((Crc&1)?HashWrapper_Crc64_Polynomial:0);
+            T[0][i]=Crc;
+        }
+        for (size_t i=0; i<256; ++i)
+            for (size_t j=1; j<8; ++j)
+                T[j][i]=(T[j-1][i]>>8)^T[0][T[j-1][i]&0xFF];
+    }
+};
+
+//---------------------------------------------------------------------------
+static const HashWrapper_Crc64_Tables& HashWrapper_Crc64_Tables_Get()
+{
+    static const HashWrapper_Crc64_Tables Tables;
+    return Tables;
+}
+
+//---------------------------------------------------------------------------
+static int64u HashWrapper_Crc64_Table(int64u Crc, const int8u* Buffer, size_t Buffer_Size)
+{
+    const HashWrapper_Crc64_Tables& Tables=HashWrapper_Crc64_Tables_Get();
+    while (Buffer_Size>=8)
+    {
+        Crc^=(int64u)Buffer[0]
+           |((int64u)Buffer[1]<< 8)
+           |((int64u)Buffer[2]<<16)
+           |((int64u)Buffer[3]<<24)
+           |((int64u)Buffer[4]<<32)
+           |((int64u)Buffer[5]<<40)
+           |((int64u)Buffer[6]<<48)
+           |((int64u)Buffer[7]<<56);
+        Crc=Tables.T[7][ Crc     &0xFF]
+           ^Tables.T[6][(Crc>> 8)&0xFF]
+           ^Tables.T[5][(Crc>>16)&0xFF]
+           ^Tables.T[4][(Crc>>24)&0xFF]
+           ^Tables.T[3][(Crc>>32)&0xFF]
+           ^Tables.T[2][(Crc>>40)&0xFF]
+           ^Tables.T[1][(Crc>>48)&0xFF]
+           ^Tables.T[0][ Crc>>56      ];
+        Buffer+=8;
+        Buffer_Size-=8;
+    }
+    while (Buffer_Size--)
+        Crc=Tables.T[0][(Crc^*Buffer++)&0xFF]^(Crc>>8);
+    return Crc;
+}
+
+#if MEDIAINFO_CRC64_CLMUL
+//---------------------------------------------------------------------------
+// Folding with carry-less multiplication, 4 lanes of 128 bits then 1 lane.
+// Constants are x^n mod P, bit-reflected, with n=575/511 (512-bit distance)
+// and n=191/127 (128-bit distance); the 128 remaining bits are reduced by
+// the table code.
+#if defined(__GNUC__)
+__attribute__((target("pclmul,sse2")))
+#endif
+static inline __m128i HashWrapper_Crc64_Fold(__m128i Value, __m128i Data, __m128i Constants)
+{
+    return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(Value, Constants, 0x00), _mm_clmulepi64_si128(Value, Constants, 0x11)), Data);
+}
+
+//---------------------------------------------------------------------------
+#if defined(__GNUC__)
+__attribute__((target("pclmul,sse2")))
+#endif
+static int64u HashWrapper_Crc64_Clmul(int64u Crc, const int8u* Buffer, size_t Buffer_Size)
+{
+    const __m128i K512=_mm_set_epi64x(0x081F6054A7842DF4LL, 0x6AE3EFBB9DD441F3LL);
+    const __m128i K128=_mm_set_epi64x((long long)0xDABE95AFC7875F40ULL, (long long)0xE05DD497CA393AE4ULL);
+
+    __m128i X0=_mm_xor_si128(_mm_loadu_si128((const __m128i*)Buffer), _mm_set_epi64x(0, (long long)Crc));
+    __m128i X1=_mm_loadu_si128((const __m128i*)(Buffer+16));
+    __m128i X2=_mm_loadu_si128((const __m128i*)(Buffer+32));
+    __m128i X3=_mm_loadu_si128((const __m128i*)(Buffer+48));
+    Buffer+=64;
+    Buffer_Size-=64;
+    while (Buffer_Size>=64)
+    {
+        X0=HashWrapper_Crc64_Fold(X0, _mm_loadu_si128((const __m128i*)Buffer     ), K512);
+        X1=HashWrapper_Crc64_Fold(X1, _mm_loadu_si128((const __m128i*)(Buffer+16)), K512);
+        X2=HashWrapper_Crc64_Fold(X2, _mm_loadu_si128((const __m128i*)(Buffer+32)), K512);
+        X3=HashWrapper_Crc64_Fold(X3, _mm_loadu_si128((const __m128i*)(Buffer+48)), K512);
+        Buffer+=64;
+        Buffer_Size-=64;
+    }
+    X0=HashWrapper_Crc64_Fold(X0, X1, K128);
+    X0=HashWrapper_Crc64_Fold(X0, X2, K128);
+    X0=HashWrapper_Crc64_Fold(X0, X3, K128);
+    while (Buffer_Size>=16)
+    {
+        X0=HashWrapper_Crc64_Fold(X0, _mm_loadu_si128((const __m128i*)Buffer), K128);
+        Buffer+=16;
+        Buffer_Size-=16;
+    }
+
+    int8u Remain[16];
+    _mm_storeu_si128((__m128i*)Remain, X0);
+    Crc=HashWrapper_Crc64_Table(0, Remain, 16);
+    return HashWrapper_Crc64_Table(Crc, Buffer, Buffer_Size);
+}
+
+//---------------------------------------------------------------------------
+static bool HashWrapper_Crc64_Clmul_IsSupported()
+{
+    #if defined(_MSC_VER)
+        int Info[4];
+        __cpuid(Info, 1);
+        return (Info[2]&(1<<1))?true:false;
+    #else
+        return __builtin_cpu_supports("pclmul")?true:false;
+    #endif
+}
+#endif //MEDIAINFO_CRC64_CLMUL
+
+//---------------------------------------------------------------------------
+static void HashWrapper_Crc64_Update(int64u* Crc, const int8u* Buffer, size_t Buffer_Size)
+{
+    #if MEDIAINFO_CRC64_CLMUL
+        static const bool Clmul=HashWrapper_Crc64_Clmul_IsSupported();
+        if (Clmul && Buffer_Size>=64)
+        {
+            *Crc=HashWrapper_Crc64_Clmul(*Crc, Buffer, Buffer_Size);
+            return;
+        }
+    #endif //MEDIAINFO_CRC64_CLMUL
+    *Crc=HashWrapper_Crc64_Table(*Crc, Buffer, Buffer_Size);
+}
+#endif //MEDIAINFO_CRC64
+
+//---------------------------------------------------------------------------
+static void HashWrapper_Update (const size_t Function, void* Context, const int8u* Buffer, const size_t Buffer_Size)
+{
+    switch (Function)
+    {
+    #if MEDIAINFO_MD5
+        case HashWrapper::MD5   : MD5Update((struct MD5Context*)Context, Buffer, (unsigned int)Buffer_Size); break;
+    #endif //MEDIAINFO_MD5
+    #if MEDIAINFO_SHA1
+        case HashWrapper::SHA1  : sha1_hash(Buffer, (unsigned long)Buffer_Size, (sha1_ctx*)Context); break;
+    #endif //MEDIAINFO_SHA1
+    #if MEDIAINFO_SHA2
+        case HashWrapper::SHA224: sha224_hash(Buffer, (unsigned long)Buffer_Size, (sha224_ctx*)Context); break;
+        case HashWrapper::SHA256: sha256_hash(Buffer, (unsigned long)Buffer_Size, (sha256_ctx*)Context); break;
+        case HashWrapper::SHA384: sha384_hash(Buffer, (unsigned long)Buffer_Size, (sha384_ctx*)Context); break;
+        case HashWrapper::SHA512: sha512_hash(Buffer, (unsigned long)Buffer_Size, (sha512_ctx*)Context); break;
+    #endif //MEDIAINFO_SHA2
+    #if MEDIAINFO_XXH3
+        case HashWrapper::XXH3_128: XXH3_128bits_update((XXH3_state_t*)Context, Buffer, Buffer_Size); break;
+    #endif //MEDIAINFO_XXH3
+    #if MEDIAINFO_CRC64
+        case HashWrapper::CRC64 : HashWrapper_Crc64_Update((int64u*)Context, Buffer, Buffer_Size); break;
+    #endif //MEDIAINFO_CRC64
+        default                 : ;
+    }
+}
+
+//***************************************************************************
+// Pipeline
+//***************************************************************************
+
+#if MEDIAINFO_HASH_THREAD
+//---------------------------------------------------------------------------
+// Data is copied once into fixed size blocks shared by all workers, a block
+// is freed when the last worker is done with it. The producer waits when too
+// many bytes are in flight, so a slow hash throttles parsing instead of
+// filling the memory.
+static const size_t HashWrapper_Block_Size=1024*1024;
+static const size_t HashWrapper_InFlight_Max=16*1024*1024;
+
+//---------------------------------------------------------------------------
+struct HashWrapper::pipeline
+{
+    struct block
+    {
+        int8u*                  Buffer;
+        size_t                  Size;
+        size_t                  Pending; //Count of workers not yet done with this block
+    };
+
+    std::mutex                  Mutex;
+    std::condition_variable     Workers_Signal;  //A block is available or Stop is set
+    std::condition_variable     Producer_Signal; //A worker is done with a block
+    std::deque<block>           Blocks;
+    int64u                      Blocks_First;    //Sequence number of Blocks.front()
+    size_t                      Blocks_Bytes;
+    int64u                      Positions[HashFunction_Max]; //Sequence number of the next block per worker
+    std::thread                 Threads[HashFunction_Max];
+    size_t                      Threads_Count;
+    bool                        Stop;
+
+    //Producer side only
+    int8u*                      Staging;
+    size_t                      Staging_Size;
+
+    pipeline()
+        : Blocks_First(0)
+        , Blocks_Bytes(0)
+        , Threads_Count(0)
+        , Stop(false)
+        , Staging(NULL)
+        , Staging_Size(0)
+    {
+        std::fill(Positions, Positions+HashFunction_Max, (int64u)0);
+    }
+
+    ~pipeline()
+    {
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            Stop=true;
+        }
+        Workers_Signal.notify_all();
+        for (size_t i=0; i<HashFunction_Max; ++i)
+            if (Threads[i].joinable())
+                Threads[i].join();
+        for (size_t i=0; i<Blocks.size(); ++i)
+            delete[] Blocks[i].Buffer;
+        delete[] Staging;
+    }
+
+    void Worker(size_t Function, void* Context)
+    {
+        std::unique_lock<std::mutex> Lock(Mutex);
+        for (;;)
+        {
+            Workers_Signal.wait(Lock, [&]{return Stop || Positions[Function]<Blocks_First+Blocks.size();});
+            if (Stop)
+                return;
+
+            const block& Block=Blocks[(size_t)(Positions[Function]-Blocks_First)];
+            const int8u* Buffer=Block.Buffer;
+            size_t Buffer_Size=Block.Size;
+            Lock.unlock();
+            HashWrapper_Update(Function, Context, Buffer, Buffer_Size);
+            Lock.lock();
+
+            Blocks[(size_t)(Positions[Function]-Blocks_First)].Pending--;
+            Positions[Function]++;
+            while (!Blocks.empty() && !Blocks.front().Pending)
+            {
+                delete[] Blocks.front().Buffer;
+                Blocks_Bytes-=Blocks.front().Size;
+                Blocks.pop_front();
+                Blocks_First++;
+            }
+            Producer_Signal.notify_all();
+        }
+    }
+
+    void Push()
+    {
+        if (!Staging_Size)
+            return;
+
+        std::unique_lock<std::mutex> Lock(Mutex);
+        Producer_Signal.wait(Lock, [&]{return Blocks_Bytes<HashWrapper_InFlight_Max;});
+        block Block={Staging, Staging_Size, Threads_Count};
+        Blocks.push_back(Block);
+        Blocks_Bytes+=Staging_Size;
+        Lock.unlock();
+        Workers_Signal.notify_all();
+
+        Staging=NULL;
+        Staging_Size=0;
+    }
+
+    void Update(const int8u* Buffer, size_t Buffer_Size)
+    {
+        while (Buffer_Size)
+        {
+            if (!Staging)
+                Staging=new int8u[HashWrapper_Block_Size];
+            size_t ToCopy=std::min(HashWrapper_Block_Size-Staging_Size, Buffer_Size);
+            std::memcpy(Staging+Staging_Size, Buffer, ToCopy);
+            Staging_Size+=ToCopy;
+            Buffer+=ToCopy;
+            Buffer_Size-=ToCopy;
+            if (Staging_Size==HashWrapper_Block_Size)
+                Push();
+        }
+    }
+
+    void Wait(size_t Function)
+    {
+        Push();
+        std::unique_lock<std::mutex> Lock(Mutex);
+        Producer_Signal.wait(Lock, [&]{return Positions[Function]==Blocks_First+Blocks.size();});
+    }
+};
+#endif //MEDIAINFO_HASH_THREAD
+
 
 //***************************************************************************
 // Constructor/Destructor
@@ -67,6 +401,9 @@ void HashWrapper::Init (const HashFunctions &Functions)
     {
         memset(m, 0, sizeof(m));
     }
+    #if MEDIAINFO_HASH_THREAD
+        Pipeline=NULL;
+    #endif //MEDIAINFO_HASH_THREAD
 
     #if MEDIAINFO_MD5
         if (Functions[MD5])
@@ -106,10 +443,50 @@ void HashWrapper::Init (const HashFunctions &Functions)
             sha512_begin((sha512_ctx*)m[SHA512]);
         }
     #endif //MEDIAINFO_SHA2
+
+    #if MEDIAINFO_XXH3
+        if (Functions[XXH3_128])
+        {
+            m[XXH3_128]=XXH3_createState(); //Aligned allocation
+            XXH3_128bits_reset((XXH3_state_t*)m[XXH3_128]);
+        }
+    #endif //MEDIAINFO_XXH3
+
+    #if MEDIAINFO_CRC64
+        if (Functions[CRC64])
+            m[CRC64]=new int64u((int64u)-1);
+    #endif //MEDIAINFO_CRC64
+}
+
+//---------------------------------------------------------------------------
+void HashWrapper::Thread_Start ()
+{
+    #if MEDIAINFO_HASH_THREAD
+        Pipeline=new pipeline;
+        try
+        {
+            for (size_t i=0; i<HashFunction_Max; ++i)
+                if (m[i])
+                {
+                    Pipeline->Threads[i]=std::thread(&pipeline::Worker, Pipeline, i, m[i]);
+                    Pipeline->Threads_Count++;
+                }
+        }
+        catch (...)
+        {
+            //No thread available, falling back to inline hashing
+            delete Pipeline; Pipeline=NULL;
+        }
+    #endif //MEDIAINFO_HASH_THREAD
 }
 
+//---------------------------------------------------------------------------
 HashWrapper::~HashWrapper ()
 {
+    #if MEDIAINFO_HASH_THREAD
+        delete Pipeline; //Joins the workers before the contexts are deleted
+    #endif //MEDIAINFO_HASH_THREAD
+
     #if MEDIAINFO_MD5
         delete (struct MD5Context*)m[MD5];
     #endif //MEDIAINFO_MD5
@@ -124,34 +501,40 @@ HashWrapper::~HashWrapper ()
         delete (sha384_ctx*)m[SHA384];
         delete (sha512_ctx*)m[SHA512];
     #endif //MEDIAINFO_SHA2
+
+    #if MEDIAINFO_XXH3
+        XXH3_freeState((XXH3_state_t*)m[XXH3_128]);
+    #endif //MEDIAINFO_XXH3
+
+    #if MEDIAINFO_CRC64
+        delete (int64u*)m[CRC64];
+    #endif //MEDIAINFO_CRC64
 }
 
+//---------------------------------------------------------------------------
 void HashWrapper::Update (const int8u* Buffer, const size_t Buffer_Size)
 {
-    #if MEDIAINFO_MD5
-        if (m[MD5])
-            MD5Update((struct MD5Context*)m[MD5], Buffer, (unsigned int)Buffer_Size);
-    #endif //MEDIAINFO_MD5
-
-    #if MEDIAINFO_SHA1
-        if (m[SHA1])
-            sha1_hash(Buffer, (unsigned long)Buffer_Size, (sha1_ctx*)m[SHA1]);
-    #endif //MEDIAINFO_SHA1
+    #if MEDIAINFO_HASH_THREAD
+        if (Pipeline)
+        {
+            Pipeline->Update(Buffer, Buffer_Size);
+            return;
+        }
+    #endif //MEDIAINFO_HASH_THREAD
 
-    #if MEDIAINFO_SHA2
-        if (m[SHA224])
-            sha224_hash(Buffer, (unsigned long)Buffer_Size, (sha224_ctx*)m[SHA224]);
-        if (m[SHA256])
-            sha256_hash(Buffer, (unsigned long)Buffer_Size, (sha256_ctx*)m[SHA256]);
-        if (m[SHA384])
-            sha384_hash(Buffer, (unsigned long)Buffer_Size, (sha384_ctx*)m[SHA384]);
-        if (m[SHA512])
-            sha512_hash(Buffer, (unsigned long)Buffer_Size, (sha512_ctx*)m[SHA512]);
-    #endif //MEDIAINFO_SHA2
+    for (size_t i=0; i<HashFunction_Max; ++i)
+        if (m[i])
+            HashWrapper_Update(i, m[i], Buffer, Buffer_Size);
 }
 
+//---------------------------------------------------------------------------
 string HashWrapper::Generate (const HashFunction Function)
 {
+    #if MEDIAINFO_HASH_THREAD
+        if (Pipeline && m[Function])
+            Pipeline->Wait(Function); //The worker is idle after that, the context can be used here
+    #endif //MEDIAINFO_HASH_THREAD
+
     #if MEDIAINFO_MD5
         if (Function==MD5 && m[MD5])
         {
@@ -197,9 +580,30 @@ string HashWrapper::Generate (const HashFunction Function)
         }
     #endif //MEDIAINFO_SHA2
 
+    #if MEDIAINFO_XXH3
+        if (Function==XXH3_128 && m[XXH3_128])
+        {
+            XXH128_canonical_t Digest;
+            XXH128_canonicalFromHash(&Digest, XXH3_128bits_digest((XXH3_state_t*)m[XXH3_128]));
+            return Hex2String(Digest.digest, 16);
+        }
+    #endif //MEDIAINFO_XXH3
+
+    #if MEDIAINFO_CRC64
+        if (Function==CRC64 && m[CRC64])
+        {
+            int64u Crc=~*(int64u*)m[CRC64];
+            unsigned char Digest[8];
+            for (size_t i=0; i<8; ++i)
+                Digest[i]=(int8u)(Crc>>(56-i*8));
+            return Hex2String(Digest, 8);
+        }
+    #endif //MEDIAINFO_CRC64
+
     return string();
 }
 
+//---------------------------------------------------------------------------
 string HashWrapper::Name (const HashFunction Function)
 {
     #if MEDIAINFO_MD5
@@ -223,9 +627,20 @@ string HashWrapper::Name (const HashFunction Function)
             return "SHA-512";
     #endif //MEDIAINFO_SHA2
 
+    #if MEDIAINFO_XXH3
+        if (Function==XXH3_128)
+            return "XXH3-128";
+    #endif //MEDIAINFO_XXH3
+
+    #if MEDIAINFO_CRC64
+        if (Function==CRC64)
+            return "CRC-64";
+    #endif //MEDIAINFO_CRC64
+
     return string();
 }
 
+//---------------------------------------------------------------------------
 string HashWrapper::Hex2String(const int8u* Digest, const size_t Digest_Size)
 {
     string DigestS;
@@ -238,6 +653,98 @@ string HashWrapper::Hex2String(const int8u* Digest, const size_t Digest_Size)
     return DigestS;
 }
 
+//***************************************************************************
+// Fingerprint
+//***************************************************************************
+
+#if MEDIAINFO_FINGERPRINT
+//---------------------------------------------------------------------------
+static const int64u HashFingerprint_Block_Size=64*1024;
+
+//---------------------------------------------------------------------------
+HashFingerprint::HashFingerprint (int64u File_Size_, size_t Block_Count_)
+    : File_Size(File_Size_)
+    , Block_Count(Block_Count_)
+{
+    block Block;
+    Block.Filled=0;
+    if (File_Size<=HashFingerprint_Block_Size*(Block_Count+2))
+    {
+        //Small file, all blocks are contiguous
+        for (Block.Begin=0; Block.Begin<File_Size; Block.Begin+=HashFingerprint_Block_Size)
+        {
+            Block.End=Block.Begin+HashFingerprint_Block_Size<File_Size?(Block.Begin+HashFingerprint_Block_Size):File_Size;
+            Blocks.push_back(Block);
+        }
+        return;
+    }
+
+    //Header, evenly spaced blocks, footer; blocks do not overlap
+    for (size_t i=0; i<Block_Count+2; ++i)
+    {
+        Block.Begin=i==Block_Count+1?(File_Size-HashFingerprint_Block_Size):((File_Size-HashFingerprint_Block_Size)/(Block_Count+1)*i);
+        Block.End=Block.Begin+HashFingerprint_Block_Size;
+        Blocks.push_back(Block);
+    }
+}
+
+//---------------------------------------------------------------------------
+void HashFingerprint::Update (int64u Offset, const int8u* Buffer, size_t Buffer_Size)
+{
+    for (size_t i=0; i<Blocks.size(); ++i)
+    {
+        block& Block=Blocks[i];
+        int64u Missing=Block.Begin+Block.Filled;
+        if (Missing==Block.End || Missing<Offset || Missing>=Offset+Buffer_Size)
+            continue; //Complete, or the buffer does not continue the block
+
+        size_t ToCopy=(size_t)((Block.End<Offset+Buffer_Size?Block.End:(Offset+Buffer_Size))-Missing);
+        Block.Data.append((const char*)Buffer+(size_t)(Missing-Offset), ToCopy);
+        Block.Filled+=ToCopy;
+        if (Block.Begin+Block.Filled==Block.End)
+        {
+            XXH128_canonical_t Digest;
+            XXH128_canonicalFromHash(&Digest, XXH3_128bits(Block.Data.data(), Block.Data.size()));
+            memcpy(Block.Digest, Digest.digest, 16);
+            string().swap(Block.Data);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------
+int64u HashFingerprint::Next () const
+{
+    for (size_t i=0; i<Blocks.size(); ++i)
+        if (Blocks[i].Begin+Blocks[i].Filled<Blocks[i].End)
+            return Blocks[i].Begin+Blocks[i].Filled;
+    return (int64u)-1;
+}
+
+//---------------------------------------------------------------------------
+string HashFingerprint::Generate () const
+{
+    if (Next()!=(int64u)-1)
+        return string();
+
+    //Parameters then digests of the blocks, so fingerprints with different sampling never match
+    XXH3_state_t* State=XXH3_createState();
+    XXH3_128bits_reset(State);
+    int8u Header[16];
+    for (size_t i=0; i<8; ++i)
+    {
+        Header[i]=(int8u)(File_Size>>(56-i*8));
+        Header[8+i]=(int8u)(((int64u)Block_Count)>>(56-i*8));
+    }
+    XXH3_128bits_update(State, Header, 16);
+    for (size_t i=0; i<Blocks.size(); ++i)
+        XXH3_128bits_update(State, Blocks[i].Digest, 16);
+    XXH128_canonical_t Digest;
+    XXH128_canonicalFromHash(&Digest, XXH3_128bits_digest(State));
+    XXH3_freeState(State);
+    return HashWrapper::Hex2String(Digest.digest, 16);
+}
+#endif //MEDIAINFO_FINGERPRINT
+
 } //NameSpace
 
 #endif //MEDIAINFO_HASH
@@ -11,11 +11,16 @@
 
 //---------------------------------------------------------------------------
 #include "MediaInfo/Setup.h"
-#if MEDIAINFO_MD5 || MEDIAINFO_SHA1 || MEDIAINFO_SHA2
+#if MEDIAINFO_MD5 || MEDIAINFO_SHA1 || MEDIAINFO_SHA2 || MEDIAINFO_XXH3 || MEDIAINFO_CRC64
     #define MEDIAINFO_HASH 1
-#else //MEDIAINFO_MD5 || MEDIAINFO_SHA1 || MEDIAINFO_SHA2
+#else //MEDIAINFO_MD5 || MEDIAINFO_SHA1 || MEDIAINFO_SHA2 || MEDIAINFO_XXH3 || MEDIAINFO_CRC64
     #define MEDIAINFO_HASH 0
-#endif //MEDIAINFO_MD5 || MEDIAINFO_SHA1 || MEDIAINFO_SHA2
+#endif //MEDIAINFO_MD5 || MEDIAINFO_SHA1 || MEDIAINFO_SHA2 || MEDIAINFO_XXH3 || MEDIAINFO_CRC64
+#if MEDIAINFO_XXH3
+    #define MEDIAINFO_FINGERPRINT 1
+#else //MEDIAINFO_XXH3
+    #define MEDIAINFO_FINGERPRINT 0
+#endif //MEDIAINFO_XXH3
 //---------------------------------------------------------------------------
 
 #if MEDIAINFO_HASH
@@ -23,10 +28,12 @@
 //---------------------------------------------------------------------------
 #include <string>
 #include <bitset>
+#include <vector>
 #include "ZenLib/Conf.h"
 using namespace ZenLib;
 using std::bitset;
 using std::string;
+using std::vector;
 //---------------------------------------------------------------------------
 
 namespace MediaInfoLib
@@ -53,12 +60,19 @@ public:
         SHA256,
         SHA384,
         SHA512,
+#endif
+#if MEDIAINFO_XXH3
+        XXH3_128,
+#endif
+#if MEDIAINFO_CRC64
+        CRC64,
 #endif
         HashFunction_Max,
     };
     typedef bitset<HashFunction_Max> HashFunctions;
 
     HashWrapper                 (const HashFunctions &Functions)                                                {Init(Functions);}
+    HashWrapper                 (const HashFunctions &Functions, const bool Threaded)                           {Init(Functions); if (Threaded) Thread_Start();} //Threaded: each function runs on its own thread, Update() only queues a copy of the data
     HashWrapper                 (const HashFunctions &Functions, const int8u* Buffer, const size_t Buffer_Size) {Init(Functions); Update(Buffer, Buffer_Size);}
     ~HashWrapper                ();
 
@@ -72,7 +86,41 @@ public:
 private:
     void    Init(const HashFunctions &Functions);
     void*   m[HashFunction_Max];
+
+    #if MEDIAINFO_HASH_THREAD
+    struct  pipeline;
+    pipeline* Pipeline;
+    #endif //MEDIAINFO_HASH_THREAD
+    void    Thread_Start();
+};
+
+//---------------------------------------------------------------------------
+// Sampled fingerprint: XXH3-128 of the header, the footer and Block_Count
+// evenly spaced blocks (whole file if small), with the file size
+#if MEDIAINFO_FINGERPRINT
+class HashFingerprint
+{
+public:
+    HashFingerprint             (int64u File_Size, size_t Block_Count);
+
+    void            Update      (int64u Offset, const int8u* Buffer, size_t Buffer_Size); //Data not in a sampled block is ignored
+    int64u          Next        () const; //Offset of the first missing byte, (int64u)-1 if complete
+    string          Generate    () const;
+
+private:
+    struct block
+    {
+        int64u      Begin;
+        int64u      End;
+        int64u      Filled; //Count of bytes received from Begin
+        string      Data;   //Released when the block is complete
+        int8u       Digest[16];
+    };
+    vector<block>   Blocks;
+    int64u          File_Size;
+    size_t          Block_Count;
 };
+#endif //MEDIAINFO_FINGERPRINT
 
 } //NameSpace
 
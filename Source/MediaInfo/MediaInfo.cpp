@@ -162,6 +162,12 @@ String MediaInfo::Get(stream_t StreamKind, size_t StreamPos, const String &Param
     return Internal->Get(StreamKind, StreamPos, Parameter, KindOfInfo, KindOfSearch);
 }
 
+//---------------------------------------------------------------------------
+size_t MediaInfo::Get(size_t Count, const stream_t* StreamKinds, const size_t* StreamPoss, const String* Parameters, String* Results, info_t KindOfInfo)
+{
+    return Internal->Get(Count, StreamKinds, StreamPoss, Parameters, Results, KindOfInfo);
+}
+
 //***************************************************************************
 // Set File info
 //***************************************************************************
@@ -144,6 +144,17 @@ public :
         /// @return a string about information you search \n
         ///         an empty string if there is a problem
     String Get (stream_t StreamKind, size_t StreamNumber, const String &Parameter, info_t InfoKind=Info_Text, info_t SearchKind=Info_Name);
+        /// Get several pieces of information about a file in one call (parameters are strings)
+        /// @brief Get several pieces of information about a file in one call
+        /// @param Count Count of requests (size of each array)
+        /// @param StreamKinds Kind of stream of each request
+        /// @param StreamNumbers Stream number of each request
+        /// @param Parameters Parameter of each request, in string format ("Codec", "Width"...)
+        /// @param Results Array of Count strings filled with the information you search (empty string if there is a problem)
+        /// @param InfoKind Kind of information you want about the parameters (the text, the measure, the help...)
+        /// @return Count of non-empty results
+        /// @warning The batch is not atomic, each request is done as a separate Get()
+    size_t Get (size_t Count, const stream_t* StreamKinds, const size_t* StreamNumbers, const String* Parameters, String* Results, info_t InfoKind=Info_Text);
 
     //Set
         /// (NOT IMPLEMENTED YET) Set a piece of information about a file (parameter is an integer)
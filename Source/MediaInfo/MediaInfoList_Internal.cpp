@@ -58,6 +58,7 @@ MediaInfoList_Internal::MediaInfoList_Internal(size_t Count_Init)
     CountValid=0;
 
     //Threading
+    ParseThreads=0;
     BlockMethod=0;
     State=0;
     IsInThread=false;
@@ -151,7 +152,8 @@ size_t MediaInfoList_Internal::Open(const String &File_Name, const fileoptions_t
 }
 
 #if defined(MEDIAINFO_FILE_YES)
-static size_t RemoveFilesFromList(std::queue<String>& ToParse, Ztring CompleteName_Begin, const Ztring &CompleteName_Last)
+template<typename parsing>
+static size_t RemoveFilesFromList(std::queue<String>& ToParse, std::deque<parsing>& Parsing, Ztring CompleteName_Begin, const Ztring &CompleteName_Last)
 {
     size_t Removed=0;
     size_t Pos=0;
@@ -165,6 +167,15 @@ static size_t RemoveFilesFromList(std::queue<String>& ToParse, Ztring CompleteNa
     if (Pos<CompleteName_Begin.size())
     {
         CompleteName_Begin.resize(Pos);
+
+        //Files already in the parsing pool are dropped when their parsing is finished
+        for (size_t i=0; i<Parsing.size(); i++)
+        {
+            if (Parsing[i].FileName.find(CompleteName_Begin)!=0)
+                return Removed;
+            Parsing[i].IsDropped=true;
+        }
+
         while (!ToParse.empty() && ToParse.front().find(CompleteName_Begin)==0)
         {
             ToParse.pop();
@@ -175,11 +186,18 @@ static size_t RemoveFilesFromList(std::queue<String>& ToParse, Ztring CompleteNa
 }
 #endif //defined(MEDIAINFO_FILE_YES)
 
+//---------------------------------------------------------------------------
 void MediaInfoList_Internal::Entry()
 {
     if (ToParse_Total==0)
         return;
 
+    if (ParseThreads>1)
+    {
+        Entry_Parallel();
+        return;
+    }
+
     for (;;)
     {
         CS.Enter();
@@ -202,9 +220,7 @@ void MediaInfoList_Internal::Entry()
                 if (Skip)
                     continue;
             #endif //defined(MEDIAINFO_FILE_YES)
-            MediaInfo_Internal* MI=new MediaInfo_Internal();
-            for (std::map<String, String>::iterator Config_MediaInfo_Item=Config_MediaInfo_Items.begin(); Config_MediaInfo_Item!=Config_MediaInfo_Items.end(); ++Config_MediaInfo_Item)
-                MI->Option(Config_MediaInfo_Item->first, Config_MediaInfo_Item->second);
+            MediaInfo_Internal* MI=Entry_New();
             if (BlockMethod==1)
                 MI->Option(__T("Thread"), __T("1"));
             Info.push_back(MI);
@@ -229,55 +245,7 @@ void MediaInfoList_Internal::Entry()
             CS.Enter();
             ToParse_AlreadyDone++;
 
-            #if defined(MEDIAINFO_FILE_YES)
-                //Removing sequences of files from the list
-                if (!MI->Get(Stream_General, 0, General_CompleteName_Last).empty())
-                    ToParse_AlreadyDone+=RemoveFilesFromList(ToParse, MI->Get(Stream_General, 0, General_CompleteName),
-                                                                      MI->Get(Stream_General, 0, General_CompleteName_Last));
-                if (MI->Config.File_TestDirectory_Get() && MI->Get(Stream_General, 0, General_Format)==__T("Directory"))
-                {
-                    for (size_t StreamKind=Stream_General+1; StreamKind<Stream_Max; StreamKind++)
-                        for (size_t StreamPos=0; StreamPos<MI->Count_Get((stream_t)StreamKind); StreamPos++)
-                        {
-                            if (!MI->Get((stream_t)StreamKind, StreamPos, __T("Source_Last")).empty())
-                                ToParse_AlreadyDone+=RemoveFilesFromList(ToParse, MI->Get(Stream_General, 0, General_CompleteName)+MI->Get((stream_t)StreamKind, StreamPos, __T("Source")),
-                                                                                  MI->Get(Stream_General, 0, General_CompleteName)+MI->Get((stream_t)StreamKind, StreamPos, __T("Source_Last")));
-                            else
-                            {
-                                Ztring Source=MI->Get((stream_t)StreamKind, StreamPos, __T("Source"));
-                                if (!Source.empty())
-                                {
-                                    Ztring Dir=MI->Get(Stream_General, 0, General_CompleteName);
-                                    if (!Dir.empty() && Dir[Dir.size()-1]!=__T('/') && Dir[Dir.size()-1]!=__T('\\'))
-                                    {
-                                        size_t Separator_Pos=Dir.find_last_of(__T("\\/"));
-                                        if (Separator_Pos!=string::npos)
-                                            Dir.resize(Separator_Pos+1);
-                                        else
-                                            Dir.clear();
-                                    }
-                                    size_t i;
-                                    if (PathSeparator!=__T('/'))
-                                        while ((i=Source.find(__T('/')))!=string::npos)
-                                            Source[i]=PathSeparator;
-                                    if (PathSeparator!=__T('\\'))
-                                        while ((i=Source.find(__T('\\')))!=string::npos)
-                                            Source[i]=PathSeparator;
-                                    Source=Dir+Source;
-                                    i=0;
-                                    for (; i<Info.size(); i++)
-                                        if (Info[i]->Get(Stream_General, 0, General_CompleteName)==Source)
-                                        {
-                                            delete Info[i];
-                                            Info.erase(Info.begin()+i);
-                                        }
-                                    if (i>=Info.size())
-                                        ToParse_ToIgnore.push_back(Source);
-                                }
-                            }
-                        }
-                }
-            #endif //defined(MEDIAINFO_FILE_YES)
+            Entry_Finish(MI);
         }
 
         State=ToParse_AlreadyDone*10000/ToParse_Total;
@@ -293,6 +261,217 @@ void MediaInfoList_Internal::Entry()
     }
 }
 
+//---------------------------------------------------------------------------
+void MediaInfoList_Internal_Worker::Entry()
+{
+    Base->Entry_Worker(this);
+}
+
+//---------------------------------------------------------------------------
+void MediaInfoList_Internal::Entry_Parallel()
+{
+    size_t Workers_Count;
+    {
+    CriticalSectionLocker CSL(CS);
+    Workers_Count=ParseThreads<ToParse.size()?ParseThreads:ToParse.size();
+    }
+
+    std::vector<MediaInfoList_Internal_Worker*> Workers;
+    for (size_t Pos=0; Pos<Workers_Count; Pos++)
+    {
+        MediaInfoList_Internal_Worker* Worker=new MediaInfoList_Internal_Worker;
+        Worker->Base=this;
+        Workers.push_back(Worker);
+        Worker->Run();
+    }
+
+    for (;;)
+    {
+        bool IsFinished=true;
+        for (size_t Pos=0; Pos<Workers.size(); Pos++)
+            if (!Workers[Pos]->IsExited())
+                IsFinished=false;
+        if (IsFinished)
+            break;
+        if (IsTerminating())
+            for (size_t Pos=0; Pos<Workers.size(); Pos++)
+                Workers[Pos]->RequestTerminate();
+
+        CS.Enter();
+        size_t InProgress=0;
+        for (size_t Pos=0; Pos<Parsing.size(); Pos++)
+            InProgress+=Parsing[Pos].MI->State_Get();
+        State=(ToParse_AlreadyDone*10000+InProgress)/ToParse_Total;
+        if (State>=10000)
+            State=9999; //Not finished while a worker is still running
+        CS.Leave();
+        Sleep(10);
+    }
+
+    for (size_t Pos=0; Pos<Workers.size(); Pos++)
+        delete Workers[Pos];
+
+    CriticalSectionLocker CSL(CS);
+    for (size_t Pos=0; Pos<Parsing.size(); Pos++)
+        delete Parsing[Pos].MI; //Interrupted before the end, not in order
+    Parsing.clear();
+    State=ToParse_AlreadyDone*10000/ToParse_Total;
+}
+
+//---------------------------------------------------------------------------
+void MediaInfoList_Internal::Entry_Worker(MediaInfoList_Internal_Worker* Worker)
+{
+    for (;;)
+    {
+        Ztring FileName;
+        MediaInfo_Internal* MI;
+        {
+        CriticalSectionLocker CSL(CS);
+        if (Worker->IsTerminating() || !Entry_Next(FileName))
+            break;
+        MI=Entry_New();
+
+        //Reserving the position in Info[] now, so output order does not depend on parsing time
+        parsing Item;
+        Item.FileName=FileName;
+        Item.MI=MI;
+        Item.IsParsed=false;
+        Item.IsDropped=false;
+        Parsing.push_back(Item);
+        }
+
+        MI->Open(FileName);
+
+        CriticalSectionLocker CSL(CS);
+        for (size_t Pos=0; Pos<Parsing.size(); Pos++)
+            if (Parsing[Pos].MI==MI)
+            {
+                Parsing[Pos].IsParsed=true;
+                break;
+            }
+        Entry_Finish_InOrder();
+    }
+}
+
+//---------------------------------------------------------------------------
+bool MediaInfoList_Internal::Entry_Next(Ztring &FileName)
+{
+    while (!ToParse.empty())
+    {
+        FileName=ToParse.front();
+        ToParse.pop();
+        #if defined(MEDIAINFO_FILE_YES)
+            bool Skip=false;
+            for (size_t i=0; i<ToParse_ToIgnore.size(); i++)
+                if (ToParse_ToIgnore[i]==FileName)
+                {
+                    ToParse_ToIgnore.erase(ToParse_ToIgnore.begin()+i);
+                    ToParse_AlreadyDone++;
+                    Skip=true;
+                    break;
+                }
+            if (Skip)
+                continue;
+        #endif //defined(MEDIAINFO_FILE_YES)
+        return true;
+    }
+
+    return false;
+}
+
+//---------------------------------------------------------------------------
+MediaInfo_Internal* MediaInfoList_Internal::Entry_New()
+{
+    MediaInfo_Internal* MI=new MediaInfo_Internal();
+    for (std::map<String, String>::iterator Config_MediaInfo_Item=Config_MediaInfo_Items.begin(); Config_MediaInfo_Item!=Config_MediaInfo_Items.end(); ++Config_MediaInfo_Item)
+        MI->Option(Config_MediaInfo_Item->first, Config_MediaInfo_Item->second);
+    #if MEDIAINFO_CACHE
+        MI->Cache_IsFromList=true;
+    #endif //MEDIAINFO_CACHE
+    return MI;
+}
+
+//---------------------------------------------------------------------------
+void MediaInfoList_Internal::Entry_Finish(MediaInfo_Internal* MI)
+{
+    #if defined(MEDIAINFO_FILE_YES)
+        //Removing sequences of files from the list
+        if (!MI->Get(Stream_General, 0, General_CompleteName_Last).empty())
+            ToParse_AlreadyDone+=RemoveFilesFromList(ToParse, Parsing, MI->Get(Stream_General, 0, General_CompleteName),
+                                                              MI->Get(Stream_General, 0, General_CompleteName_Last));
+        if (MI->Config.File_TestDirectory_Get() && MI->Get(Stream_General, 0, General_Format)==__T("Directory"))
+        {
+            for (size_t StreamKind=Stream_General+1; StreamKind<Stream_Max; StreamKind++)
+                for (size_t StreamPos=0; StreamPos<MI->Count_Get((stream_t)StreamKind); StreamPos++)
+                {
+                    if (!MI->Get((stream_t)StreamKind, StreamPos, __T("Source_Last")).empty())
+                        ToParse_AlreadyDone+=RemoveFilesFromList(ToParse, Parsing, MI->Get(Stream_General, 0, General_CompleteName)+MI->Get((stream_t)StreamKind, StreamPos, __T("Source")),
+                                                                          MI->Get(Stream_General, 0, General_CompleteName)+MI->Get((stream_t)StreamKind, StreamPos, __T("Source_Last")));
+                    else
+                    {
+                        Ztring Source=MI->Get((stream_t)StreamKind, StreamPos, __T("Source"));
+                        if (!Source.empty())
+                        {
+                            Ztring Dir=MI->Get(Stream_General, 0, General_CompleteName);
+                            if (!Dir.empty() && Dir[Dir.size()-1]!=__T('/') && Dir[Dir.size()-1]!=__T('\\'))
+                            {
+                                size_t Separator_Pos=Dir.find_last_of(__T("\\/"));
+                                if (Separator_Pos!=string::npos)
+                                    Dir.resize(Separator_Pos+1);
+                                else
+                                    Dir.clear();
+                            }
+                            size_t i;
+                            if (PathSeparator!=__T('/'))
+                                while ((i=Source.find(__T('/')))!=string::npos)
+                                    Source[i]=PathSeparator;
+                            if (PathSeparator!=__T('\\'))
+                                while ((i=Source.find(__T('\\')))!=string::npos)
+                                    Source[i]=PathSeparator;
+                            Source=Dir+Source;
+                            bool IsInParsing=false;
+                            for (i=0; i<Parsing.size(); i++)
+                                if (Parsing[i].FileName==Source)
+                                {
+                                    Parsing[i].IsDropped=true;
+                                    IsInParsing=true;
+                                }
+                            if (IsInParsing)
+                                continue;
+                            i=0;
+                            for (; i<Info.size(); i++)
+                                if (Info[i]->Get(Stream_General, 0, General_CompleteName)==Source)
+                                {
+                                    delete Info[i];
+                                    Info.erase(Info.begin()+i);
+                                }
+                            if (i>=Info.size())
+                                ToParse_ToIgnore.push_back(Source);
+                        }
+                    }
+                }
+        }
+}
+
+//---------------------------------------------------------------------------
+void MediaInfoList_Internal::Entry_Finish_InOrder()
+{
+    //Files are moved to Info[] in the order they were in ToParse, whatever the order of parsing end
+    while (!Parsing.empty() && Parsing.front().IsParsed)
+    {
+        parsing Item=Parsing.front();
+        Parsing.pop_front();
+        ToParse_AlreadyDone++;
+        if (Item.IsDropped)
+        {
+            delete Item.MI;
+            continue;
+        }
+        Info.push_back(Item.MI);
+        Entry_Finish(Item.MI);
+    }
+}
+
 //---------------------------------------------------------------------------
 size_t MediaInfoList_Internal::Open_Buffer_Init (int64u File_Size_, int64u File_Offset_)
 {
@@ -491,10 +670,21 @@ String MediaInfoList_Internal::Option (const String &Option, const String &Value
         BlockMethod=1;
         return __T("");
     }
+    else if (OptionLower==__T("parsethreads"))
+    {
+        if (Value.empty())
+            return Ztring::ToZtring(ParseThreads);
+        ParseThreads=Ztring(Value).To_int32u();
+        return __T("");
+    }
     #if MEDIAINFO_ADVANCED
         else if (OptionLower.find(__T("file_inform_stringpointer")) == 0 && Info.size() == 1)
             return Info[0]->Option(Option, Value);
     #endif //MEDIAINFO_ADVANCED
+    #if MEDIAINFO_BINARY
+        else if (OptionLower.find(__T("file_binary_stringpointer")) == 0 && Info.size() == 1)
+            return Info[0]->Option(Option, Value);
+    #endif //MEDIAINFO_BINARY
     else if (OptionLower.find(__T("reset"))==0)
     {
         Config_MediaInfo_Items.clear();
@@ -528,12 +718,14 @@ size_t MediaInfoList_Internal::State_Get()
         IsInThread=false;
     }
 
-    if (!Info.empty())
+    if (!Info.empty() || !Parsing.empty())
     {
         State=0;
         for (size_t Pos=0; Pos<Info.size(); Pos++)
             State+=Info[Pos]->State_Get();
-        State/=Info.size()+ToParse.size();
+        for (size_t Pos=0; Pos<Parsing.size(); Pos++)
+            State+=Parsing[Pos].MI->State_Get();
+        State/=Info.size()+Parsing.size()+ToParse.size();
     }
 
     return State;
@@ -19,11 +19,20 @@
 #include "MediaInfo/MediaInfo.h"
 #include "MediaInfo/MediaInfo_Internal.h"
 #include <queue>
+#include <deque>
 //---------------------------------------------------------------------------
 
 namespace MediaInfoLib
 {
 
+class MediaInfoList_Internal;
+class MediaInfoList_Internal_Worker : public ZenLib::Thread
+{
+public:
+    MediaInfoList_Internal* Base;
+    void Entry();
+};
+
 class MediaInfoList_Internal : public ZenLib::Thread
 {
 public :
@@ -77,6 +86,24 @@ private :
     bool    IsInThread;
     void    Entry();
     ZenLib::CriticalSection CS;
+
+    //Threading - Parsing pool
+    struct parsing
+    {
+        String              FileName;
+        MediaInfo_Internal* MI;
+        bool                IsParsed;
+        bool                IsDropped;
+    };
+    std::deque<parsing> Parsing; //Files being parsed by the pool, in ToParse order
+    size_t  ParseThreads; //Count of files parsed in parallel, 0 or 1 for sequential parsing
+    void    Entry_Parallel();
+    void    Entry_Worker(MediaInfoList_Internal_Worker* Worker);
+    bool    Entry_Next(Ztring &FileName);
+    MediaInfo_Internal* Entry_New();
+    void    Entry_Finish(MediaInfo_Internal* MI);
+    void    Entry_Finish_InOrder();
+    friend class MediaInfoList_Internal_Worker;
 };
 
 } //NameSpace
@@ -0,0 +1,249 @@
+/*  Copyright (c) MediaArea.net SARL. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license that can
+ *  be found in the License.html file in the root of the source tree.
+ */
+
+//---------------------------------------------------------------------------
+// Pre-compilation
+#include "MediaInfo/PreComp.h"
+#ifdef __BORLANDC__
+    #pragma hdrstop
+#endif
+//---------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------
+#include "MediaInfo/Setup.h"
+//---------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------
+#if MEDIAINFO_BINARY
+//---------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------
+#include "MediaInfo/MediaInfo_Binary.h"
+#include "MediaInfo/MediaInfo_Const.h"
+#include <cstring>
+#include <map>
+using namespace std;
+//---------------------------------------------------------------------------
+
+namespace MediaInfoLib
+{
+
+//***************************************************************************
+// Format
+//***************************************************************************
+
+//---------------------------------------------------------------------------
+// "MIBinary" + version (1 byte), then 7-bit variable length numbers:
+// file size, count of strings + strings (UTF-8 with their length), count of
+// stream kinds, per stream kind: count of streams, per stream: count of
+// fields, count of non-empty fields + (gap from previous field, string
+// index), count of additional fields + (count of columns, string indexes).
+// Each distinct string is stored once, so repeated values and the names of
+// additional fields (including IBI) cost an index only.
+static const char   Binary_Magic[8]={'M', 'I', 'B', 'i', 'n', 'a', 'r', 'y'};
+static const int8u  Binary_Version=1;
+static const int64u Binary_Fields_Max=0x10000; //Sanity check
+
+//---------------------------------------------------------------------------
+static int64u Binary_String (map<Ztring, int64u> &Strings_Index, vector<const Ztring*> &Strings, const Ztring &Value)
+{
+    map<Ztring, int64u>::iterator Index=Strings_Index.find(Value);
+    if (Index!=Strings_Index.end())
+        return Index->second;
+    int64u ToReturn=Strings.size();
+    Strings_Index[Value]=ToReturn;
+    Strings.push_back(&Value);
+    return ToReturn;
+}
+
+//***************************************************************************
+// Detection
+//***************************************************************************
+
+//---------------------------------------------------------------------------
+bool MediaInfo_Binary::IsBinary (const int8u* Buffer, size_t Buffer_Size)
+{
+    return Buffer && Buffer_Size>sizeof(Binary_Magic) && !memcmp(Buffer, Binary_Magic, sizeof(Binary_Magic));
+}
+
+//***************************************************************************
+// Conversion
+//***************************************************************************
+
+//---------------------------------------------------------------------------
+void MediaInfo_Binary::Serialize (string &Out, const vector<vector<ZtringList> > &Stream, const vector<vector<ZtringListList> > &Stream_More, int64u File_Size)
+{
+    //Fields, as indexes in the string table
+    map<Ztring, int64u> Strings_Index;
+    vector<const Ztring*> Strings;
+    string Fields;
+    Put(Fields, (int64u)Stream.size());
+    for (size_t StreamKind=0; StreamKind<Stream.size(); StreamKind++)
+    {
+        Put(Fields, (int64u)Stream[StreamKind].size());
+        for (size_t StreamPos=0; StreamPos<Stream[StreamKind].size(); StreamPos++)
+        {
+            const ZtringList &List=Stream[StreamKind][StreamPos];
+            size_t NonEmpty_Count=0;
+            for (size_t Pos=0; Pos<List.size(); Pos++)
+                if (!List[Pos].empty())
+                    NonEmpty_Count++;
+            Put(Fields, (int64u)List.size());
+            Put(Fields, (int64u)NonEmpty_Count);
+            size_t Pos_Next=0;
+            for (size_t Pos=0; Pos<List.size(); Pos++)
+                if (!List[Pos].empty())
+                {
+                    Put(Fields, (int64u)(Pos-Pos_Next));
+                    Put(Fields, Binary_String(Strings_Index, Strings, List[Pos]));
+                    Pos_Next=Pos+1;
+                }
+
+            if (StreamKind>=Stream_More.size() || StreamPos>=Stream_More[StreamKind].size())
+            {
+                Put(Fields, (int64u)0);
+                continue;
+            }
+            const ZtringListList &More=Stream_More[StreamKind][StreamPos];
+            Put(Fields, (int64u)More.size());
+            for (size_t Pos=0; Pos<More.size(); Pos++)
+            {
+                Put(Fields, (int64u)More[Pos].size());
+                for (size_t Pos2=0; Pos2<More[Pos].size(); Pos2++)
+                    Put(Fields, Binary_String(Strings_Index, Strings, More[Pos][Pos2]));
+            }
+        }
+    }
+
+    //Header and string table
+    Out.append(Binary_Magic, sizeof(Binary_Magic));
+    Out+=(char)Binary_Version;
+    Put(Out, File_Size);
+    Put(Out, (int64u)Strings.size());
+    for (size_t Pos=0; Pos<Strings.size(); Pos++)
+    {
+        string Value=Strings[Pos]->To_UTF8();
+        Put(Out, (int64u)Value.size());
+        Out+=Value;
+    }
+    Out+=Fields;
+}
+
+//---------------------------------------------------------------------------
+size_t MediaInfo_Binary::Deserialize (const int8u* Buffer, size_t Buffer_Size, vector<vector<ZtringList> > &Stream, vector<vector<ZtringListList> > &Stream_More, int64u &File_Size)
+{
+    const int8u* Buffer_Begin=Buffer;
+    const int8u* Buffer_End=Buffer+Buffer_Size;
+    if (!IsBinary(Buffer, Buffer_Size) || Buffer[sizeof(Binary_Magic)]!=Binary_Version)
+        return 0;
+    Buffer+=sizeof(Binary_Magic)+1;
+
+    //String table, each string is converted once
+    int64u Strings_Count;
+    if (!Get(Buffer, Buffer_End, File_Size) || !Get(Buffer, Buffer_End, Strings_Count) || Strings_Count>(int64u)(Buffer_End-Buffer))
+        return 0;
+    vector<Ztring> Strings((size_t)Strings_Count);
+    for (size_t Pos=0; Pos<Strings.size(); Pos++)
+    {
+        int64u Size;
+        if (!Get(Buffer, Buffer_End, Size) || Size>(int64u)(Buffer_End-Buffer))
+            return 0;
+        Strings[Pos].From_UTF8((const char*)Buffer, (size_t)Size);
+        Buffer+=(size_t)Size;
+    }
+
+    //Streams
+    int64u StreamKind_Count;
+    if (!Get(Buffer, Buffer_End, StreamKind_Count) || StreamKind_Count!=Stream_Max)
+        return 0;
+    Stream.clear();
+    Stream.resize(Stream_Max);
+    Stream_More.clear();
+    Stream_More.resize(Stream_Max);
+    for (size_t StreamKind=0; StreamKind<Stream_Max; StreamKind++)
+    {
+        int64u StreamPos_Count;
+        if (!Get(Buffer, Buffer_End, StreamPos_Count) || StreamPos_Count>(int64u)(Buffer_End-Buffer)/3)
+            return 0;
+        Stream[StreamKind].resize((size_t)StreamPos_Count);
+        Stream_More[StreamKind].resize((size_t)StreamPos_Count);
+        for (size_t StreamPos=0; StreamPos<StreamPos_Count; StreamPos++)
+        {
+            int64u Count, NonEmpty_Count;
+            if (!Get(Buffer, Buffer_End, Count) || Count>Binary_Fields_Max
+             || !Get(Buffer, Buffer_End, NonEmpty_Count) || NonEmpty_Count>Count)
+                return 0;
+            ZtringList &List=Stream[StreamKind][StreamPos];
+            List.resize((size_t)Count);
+            int64u Pos_Next=0;
+            for (int64u NonEmpty_Pos=0; NonEmpty_Pos<NonEmpty_Count; NonEmpty_Pos++)
+            {
+                int64u Gap, Index;
+                if (!Get(Buffer, Buffer_End, Gap) || Gap>=Count-Pos_Next
+                 || !Get(Buffer, Buffer_End, Index) || Index>=Strings_Count)
+                    return 0;
+                Pos_Next+=Gap;
+                List[(size_t)Pos_Next]=Strings[(size_t)Index];
+                Pos_Next++;
+            }
+
+            if (!Get(Buffer, Buffer_End, Count) || Count>(int64u)(Buffer_End-Buffer))
+                return 0;
+            ZtringListList &More=Stream_More[StreamKind][StreamPos];
+            More.resize((size_t)Count);
+            for (size_t Pos=0; Pos<More.size(); Pos++)
+            {
+                if (!Get(Buffer, Buffer_End, Count) || Count>(int64u)(Buffer_End-Buffer))
+                    return 0;
+                More[Pos].resize((size_t)Count);
+                for (size_t Pos2=0; Pos2<More[Pos].size(); Pos2++)
+                {
+                    int64u Index;
+                    if (!Get(Buffer, Buffer_End, Index) || Index>=Strings_Count)
+                        return 0;
+                    More[Pos][Pos2]=Strings[(size_t)Index];
+                }
+            }
+        }
+    }
+
+    return Buffer-Buffer_Begin;
+}
+
+//***************************************************************************
+// Numbers
+//***************************************************************************
+
+//---------------------------------------------------------------------------
+void MediaInfo_Binary::Put (string &Out, int64u Value)
+{
+    while (Value>=0x80)
+    {
+        Out+=(char)(0x80|(Value&0x7F));
+        Value>>=7;
+    }
+    Out+=(char)Value;
+}
+
+//---------------------------------------------------------------------------
+bool MediaInfo_Binary::Get (const int8u* &Buffer, const int8u* Buffer_End, int64u &Value)
+{
+    Value=0;
+    for (int Shift=0; Shift<64; Shift+=7)
+    {
+        if (Buffer>=Buffer_End)
+            return false;
+        int8u Byte=*Buffer++;
+        Value|=((int64u)(Byte&0x7F))<<Shift;
+        if (!(Byte&0x80))
+            return true;
+    }
+    return false;
+}
+
+} //NameSpace
+
+#endif //MEDIAINFO_BINARY
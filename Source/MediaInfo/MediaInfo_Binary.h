@@ -0,0 +1,59 @@
+/*  Copyright (c) MediaArea.net SARL. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license that can
+ *  be found in the License.html file in the root of the source tree.
+ */
+
+//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//
+// Compact binary form of parsed results, for storage and transfer
+//
+//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//---------------------------------------------------------------------------
+#ifndef MediaInfo_BinaryH
+#define MediaInfo_BinaryH
+//---------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------
+#include "MediaInfo/Setup.h"
+//---------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------
+#if MEDIAINFO_BINARY
+//---------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------
+#include "ZenLib/ZtringListList.h"
+#include <string>
+#include <vector>
+using namespace ZenLib;
+//---------------------------------------------------------------------------
+
+namespace MediaInfoLib
+{
+
+//***************************************************************************
+// Class MediaInfo_Binary
+//***************************************************************************
+
+class MediaInfo_Binary
+{
+public :
+    //Detection
+    static bool   IsBinary (const int8u* Buffer, size_t Buffer_Size);
+
+    //Conversion
+    static void   Serialize (std::string &Out, const std::vector<std::vector<ZtringList> > &Stream, const std::vector<std::vector<ZtringListList> > &Stream_More, int64u File_Size); //Appended to Out
+    static size_t Deserialize (const int8u* Buffer, size_t Buffer_Size, std::vector<std::vector<ZtringList> > &Stream, std::vector<std::vector<ZtringListList> > &Stream_More, int64u &File_Size); //Count of bytes used, 0 if invalid
+
+    //Numbers
+    static void   Put (std::string &Out, int64u Value);
+    static bool   Get (const int8u* &Buffer, const int8u* Buffer_End, int64u &Value);
+};
+
+} //NameSpace
+
+#endif //MEDIAINFO_BINARY
+
+#endif
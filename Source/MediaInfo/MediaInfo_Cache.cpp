@@ -0,0 +1,423 @@
+/*  Copyright (c) MediaArea.net SARL. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license that can
+ *  be found in the License.html file in the root of the source tree.
+ */
+
+//---------------------------------------------------------------------------
+// Pre-compilation
+#include "MediaInfo/PreComp.h"
+#ifdef __BORLANDC__
+    #pragma hdrstop
+#endif
+//---------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------
+#include "MediaInfo/Setup.h"
+//---------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------
+#if MEDIAINFO_CACHE
+//---------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------
+#include "MediaInfo/MediaInfo_Cache.h"
+#include "MediaInfo/MediaInfo_Binary.h"
+#include "MediaInfo/MediaInfo_Config.h"
+#include "ZenLib/File.h"
+#include "ZenLib/Dir.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#if defined(WINDOWS)
+    #undef __TEXT
+    #include <windows.h>
+#else //WINDOWS
+    #include <unistd.h>
+#endif //WINDOWS
+using namespace std;
+//---------------------------------------------------------------------------
+
+namespace MediaInfoLib
+{
+
+//---------------------------------------------------------------------------
+extern MediaInfo_Config Config;
+MediaInfo_Cache Cache;
+//---------------------------------------------------------------------------
+
+//***************************************************************************
+// Utils
+//***************************************************************************
+
+//---------------------------------------------------------------------------
+static Ztring Cache_FullPath (const Ztring &File_Name)
+{
+    #if defined(WINDOWS)
+        #ifdef UNICODE
+            wchar_t* FullPath=_wfullpath(NULL, File_Name.c_str(), 0);
+        #else //UNICODE
+            char* FullPath=_fullpath(NULL, File_Name.c_str(), 0);
+        #endif //UNICODE
+    #else //WINDOWS
+        char* FullPath=realpath(File_Name.To_Local().c_str(), NULL);
+    #endif //WINDOWS
+    if (!FullPath)
+        return Ztring();
+
+    Ztring ToReturn;
+    #if defined(WINDOWS) && defined(UNICODE)
+        ToReturn=FullPath;
+    #else //defined(WINDOWS) && defined(UNICODE)
+        ToReturn.From_Local(FullPath);
+    #endif //defined(WINDOWS) && defined(UNICODE)
+    free(FullPath);
+    return ToReturn;
+}
+
+//---------------------------------------------------------------------------
+// Temporary file name, unique between processes (PID and time) and threads (counter)
+static Ztring Cache_FileName_Temp (const Ztring &FileName, size_t Count)
+{
+    #if defined(WINDOWS)
+        int64u ProcessId=GetCurrentProcessId();
+    #else //WINDOWS
+        int64u ProcessId=getpid();
+    #endif //WINDOWS
+    int64u Time=(int64u)chrono::high_resolution_clock::now().time_since_epoch().count();
+
+    Ztring ToReturn(FileName);
+    ToReturn+=__T('.')+Ztring::ToZtring(ProcessId);
+    ToReturn+=__T('-')+Ztring::ToZtring(Time, 16);
+    ToReturn+=__T('-')+Ztring::ToZtring(Count);
+    ToReturn+=__T(".tmp");
+    return ToReturn;
+}
+
+//---------------------------------------------------------------------------
+static size_t Cache_Size (const MediaInfo_Cache::item &Item)
+{
+    //Approximation, string content plus a fixed overhead per string
+    size_t Size=sizeof(MediaInfo_Cache::item);
+    for (size_t StreamKind=0; StreamKind<Item.Stream.size(); StreamKind++)
+        for (size_t StreamPos=0; StreamPos<Item.Stream[StreamKind].size(); StreamPos++)
+        {
+            const ZtringList &List=Item.Stream[StreamKind][StreamPos];
+            for (size_t Pos=0; Pos<List.size(); Pos++)
+                Size+=sizeof(Ztring)+List[Pos].size()*sizeof(Char);
+        }
+    for (size_t StreamKind=0; StreamKind<Item.Stream_More.size(); StreamKind++)
+        for (size_t StreamPos=0; StreamPos<Item.Stream_More[StreamKind].size(); StreamPos++)
+        {
+            const ZtringListList &List=Item.Stream_More[StreamKind][StreamPos];
+            for (size_t Pos=0; Pos<List.size(); Pos++)
+                for (size_t Pos2=0; Pos2<List[Pos].size(); Pos2++)
+                    Size+=sizeof(Ztring)+List[Pos][Pos2].size()*sizeof(Char);
+        }
+    return Size;
+}
+
+//***************************************************************************
+// Serialization
+//***************************************************************************
+
+//---------------------------------------------------------------------------
+// File content:
+// "MICache" + version (1 byte), key (7-bit variable length size + content),
+// then the results in MediaInfo_Binary format.
+static const char   Cache_Magic[7]={'M', 'I', 'C', 'a', 'c', 'h', 'e'};
+static const int8u  Cache_Version=2;
+
+//---------------------------------------------------------------------------
+static string Cache_Serialize (const string &Key, const MediaInfo_Cache::item &Item)
+{
+    string Out(Cache_Magic, sizeof(Cache_Magic));
+    Out+=(char)Cache_Version;
+    MediaInfo_Binary::Put(Out, (int64u)Key.size());
+    Out+=Key;
+    MediaInfo_Binary::Serialize(Out, Item.Stream, Item.Stream_More, Item.File_Size);
+    return Out;
+}
+
+//---------------------------------------------------------------------------
+static bool Cache_Deserialize (const int8u* Buffer, size_t Buffer_Size, const string &Key, MediaInfo_Cache::item &Item)
+{
+    const int8u* Buffer_End=Buffer+Buffer_Size;
+    if (Buffer_Size<sizeof(Cache_Magic)+1 || memcmp(Buffer, Cache_Magic, sizeof(Cache_Magic)) || Buffer[sizeof(Cache_Magic)]!=Cache_Version)
+        return false;
+    Buffer+=sizeof(Cache_Magic)+1;
+
+    //Key, a different key with the same hash is a miss
+    int64u Key_Size;
+    if (!MediaInfo_Binary::Get(Buffer, Buffer_End, Key_Size) || Key_Size!=Key.size() || Key_Size>(int64u)(Buffer_End-Buffer) || memcmp(Buffer, Key.data(), Key.size()))
+        return false;
+    Buffer+=Key.size();
+
+    size_t Binary_Size=(size_t)(Buffer_End-Buffer);
+    return Binary_Size && MediaInfo_Binary::Deserialize(Buffer, Binary_Size, Item.Stream, Item.Stream_More, Item.File_Size)==Binary_Size;
+}
+
+//---------------------------------------------------------------------------
+static Ztring Cache_FileName (const Ztring &Directory, const string &Key, bool Create=false)
+{
+    //FNV-1a 64-bit of the key, the key itself is stored in the file
+    int64u Hash=0xCBF29CE484222325ULL;
+    for (size_t Pos=0; Pos<Key.size(); Pos++)
+    {
+        Hash^=(int8u)Key[Pos];
+        Hash*=0x100000001B3ULL;
+    }
+    Ztring Hash_String=Ztring::ToZtring(Hash, 16);
+    while (Hash_String.size()<16)
+        Hash_String.insert(0, 1, __T('0'));
+
+    //256 sub-directories, for big collections
+    Ztring Path(Directory);
+    if (!Path.empty() && Path[Path.size()-1]!=PathSeparator)
+        Path+=PathSeparator;
+    Path+=Hash_String.substr(0, 2);
+    if (Create && !Dir::Exists(Path))
+        Dir::Create(Path);
+    Path+=PathSeparator;
+    Path+=Hash_String;
+    Path+=__T(".micache");
+    return Path;
+}
+
+//***************************************************************************
+// Constructor/Destructor
+//***************************************************************************
+
+//---------------------------------------------------------------------------
+MediaInfo_Cache::MediaInfo_Cache()
+{
+    Size=0;
+    MaxSize=0; //Disabled by default
+    Directory_TempCount=0;
+}
+
+//***************************************************************************
+// Key
+//***************************************************************************
+
+//---------------------------------------------------------------------------
+string MediaInfo_Cache::Key_Get (const Ztring &File_Name, const ZtringListList &Options)
+{
+    Ztring FullPath=Cache_FullPath(File_Name);
+    if (FullPath.empty())
+        return string();
+    File F;
+    if (!F.Open(FullPath))
+        return string();
+
+    Ztring Key(FullPath);
+    Key+=__T('\n');
+    Key+=Ztring::ToZtring(F.Size_Get());
+    Key+=__T('\n');
+    Key+=F.Modified_Get();
+    Key+=__T('\n');
+    Key+=MediaInfoLib::Config.Info_Version_Get();
+
+    //Options, queries and cache settings excluded
+    ZtringListList Options_Global=MediaInfoLib::Config.SubFile_Config_Get();
+    for (int Global=0; Global<2; Global++)
+    {
+        const ZtringListList &List=Global?Options_Global:Options;
+        for (size_t Pos=0; Pos<List.size(); Pos++)
+        {
+            if (List[Pos].empty())
+                continue;
+            Ztring Name=List[Pos][0];
+            Name.MakeLowerCase();
+            if (Name.empty()
+             || Name.find(__T("info_"))==0
+             || Name.find(__T("cache_"))==0
+             || (Name.size()>=4 && Name.find(__T("_get"), Name.size()-4)!=string::npos)
+             || Name.find(__T("_stringpointer"))!=string::npos)
+                continue;
+            Key+=__T('\n');
+            Key+=List[Pos][0];
+            Key+=__T('=');
+            if (List[Pos].size()>1)
+                Key+=List[Pos][1];
+        }
+    }
+    return Key.To_UTF8();
+}
+
+//***************************************************************************
+// Items
+//***************************************************************************
+
+//---------------------------------------------------------------------------
+bool MediaInfo_Cache::Get (const string &Key, item &Item)
+{
+    Ztring Directory_Current;
+    {
+        CriticalSectionLocker CSL(CS);
+        map<string, entries::iterator>::iterator Index=Items_Index.find(Key);
+        if (Index!=Items_Index.end())
+        {
+            Items.splice(Items.begin(), Items, Index->second); //Most recently used
+            Item=Index->second->Item;
+            return true;
+        }
+        Directory_Current=Directory;
+    }
+    if (Directory_Current.empty())
+        return false;
+
+    //On disk
+    File F;
+    if (!F.Open(Cache_FileName(Directory_Current, Key)))
+        return false;
+    int64u Buffer_Size=F.Size_Get();
+    if (Buffer_Size>=0x10000000) //256 MiB, not a cache file
+        return false;
+    int8u* Buffer=new int8u[(size_t)Buffer_Size];
+    bool IsOk=F.Read(Buffer, (size_t)Buffer_Size)==Buffer_Size && Cache_Deserialize(Buffer, (size_t)Buffer_Size, Key, Item);
+    delete[] Buffer;
+    if (!IsOk)
+        return false;
+
+    CriticalSectionLocker CSL(CS);
+    if (MaxSize)
+    {
+        item Item_Copy(Item);
+        Memory_Set(Key, Item_Copy);
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------
+void MediaInfo_Cache::Set (const string &Key, item &Item)
+{
+    Ztring Directory_Current;
+    {
+        CriticalSectionLocker CSL(CS);
+        Directory_Current=Directory;
+    }
+
+    //On disk, written to a temporary file then renamed so readers never see a partial file
+    if (!Directory_Current.empty())
+    {
+        string Content=Cache_Serialize(Key, Item);
+        Ztring FileName=Cache_FileName(Directory_Current, Key, true);
+        Ztring FileName_Temp;
+        File F;
+        for (size_t Retry=0; Retry<4; Retry++)
+        {
+            {
+                CriticalSectionLocker CSL(CS);
+                FileName_Temp=Cache_FileName_Temp(FileName, Directory_TempCount++);
+            }
+            if (!File::Exists(FileName_Temp) && F.Create(FileName_Temp, false))
+                break;
+            FileName_Temp.clear();
+        }
+        if (!FileName_Temp.empty())
+        {
+            bool IsOk=F.Write((const int8u*)Content.data(), Content.size())==Content.size();
+            F.Close();
+            if (!IsOk || !File::Move(FileName_Temp, FileName, true))
+                File::Delete(FileName_Temp);
+        }
+    }
+
+    CriticalSectionLocker CSL(CS);
+    if (MaxSize)
+        Memory_Set(Key, Item);
+}
+
+//---------------------------------------------------------------------------
+void MediaInfo_Cache::Memory_Set (const string &Key, item &Item)
+{
+    size_t Item_Size=Key.size()+Cache_Size(Item);
+    if (Item_Size>MaxSize)
+        return; //Would evict everything else
+
+    map<string, entries::iterator>::iterator Index=Items_Index.find(Key);
+    if (Index!=Items_Index.end())
+    {
+        Size-=Index->second->Size;
+        Items.erase(Index->second);
+    }
+    Items.push_front(entry());
+    entry &Entry=Items.front();
+    Entry.Key=Key;
+    Entry.Item.Stream.swap(Item.Stream);
+    Entry.Item.Stream_More.swap(Item.Stream_More);
+    Entry.Item.File_Size=Item.File_Size;
+    Entry.Size=Item_Size;
+    Items_Index[Key]=Items.begin();
+    Size+=Item_Size;
+
+    Trim();
+}
+
+//---------------------------------------------------------------------------
+void MediaInfo_Cache::Clear ()
+{
+    CriticalSectionLocker CSL(CS);
+    Items.clear();
+    Items_Index.clear();
+    Size=0;
+}
+
+//---------------------------------------------------------------------------
+void MediaInfo_Cache::Trim ()
+{
+    while (Size>MaxSize && !Items.empty())
+    {
+        Size-=Items.back().Size;
+        Items_Index.erase(Items.back().Key);
+        Items.pop_back();
+    }
+}
+
+//***************************************************************************
+// Config
+//***************************************************************************
+
+//---------------------------------------------------------------------------
+bool MediaInfo_Cache::IsEnabled ()
+{
+    CriticalSectionLocker CSL(CS);
+    return MaxSize || !Directory.empty();
+}
+
+//---------------------------------------------------------------------------
+void MediaInfo_Cache::MaxSize_Set (int64u NewValue)
+{
+    CriticalSectionLocker CSL(CS);
+    MaxSize=NewValue;
+    Trim();
+}
+
+//---------------------------------------------------------------------------
+int64u MediaInfo_Cache::MaxSize_Get ()
+{
+    CriticalSectionLocker CSL(CS);
+    return MaxSize;
+}
+
+//---------------------------------------------------------------------------
+void MediaInfo_Cache::Directory_Set (const Ztring &NewValue)
+{
+    if (!NewValue.empty() && !Dir::Exists(NewValue))
+        Dir::Create(NewValue);
+
+    CriticalSectionLocker CSL(CS);
+    Directory=NewValue;
+}
+
+//---------------------------------------------------------------------------
+Ztring MediaInfo_Cache::Directory_Get ()
+{
+    CriticalSectionLocker CSL(CS);
+    return Directory;
+}
+
+} //NameSpace
+
+#endif //MEDIAINFO_CACHE
@@ -0,0 +1,98 @@
+/*  Copyright (c) MediaArea.net SARL. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license that can
+ *  be found in the License.html file in the root of the source tree.
+ */
+
+//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//
+// Cache of parsed results, shared by all MediaInfo instances
+//
+//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//---------------------------------------------------------------------------
+#ifndef MediaInfo_CacheH
+#define MediaInfo_CacheH
+//---------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------
+#include "MediaInfo/Setup.h"
+//---------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------
+#if MEDIAINFO_CACHE
+//---------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------
+#include "ZenLib/ZtringListList.h"
+#include "ZenLib/CriticalSection.h"
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+using namespace ZenLib;
+//---------------------------------------------------------------------------
+
+namespace MediaInfoLib
+{
+
+//***************************************************************************
+// Class MediaInfo_Cache
+//***************************************************************************
+
+class MediaInfo_Cache
+{
+public :
+    //Item
+    struct item
+    {
+        std::vector<std::vector<ZtringList> >       Stream;
+        std::vector<std::vector<ZtringListList> >   Stream_More;
+        int64u                                      File_Size;
+    };
+
+    //Constructor/Destructor
+    MediaInfo_Cache();
+
+    //Key
+    static std::string Key_Get (const Ztring &File_Name, const ZtringListList &Options); //Canonical path, size and modification date of the file, library version and options, empty if the file is not found
+
+    //Items
+    bool   Get (const std::string &Key, item &Item);
+    void   Set (const std::string &Key, item &Item); //Item content is moved to the cache
+    void   Clear ();
+
+    //Config
+    bool   IsEnabled ();
+    void   MaxSize_Set (int64u NewValue);
+    int64u MaxSize_Get ();
+    void   Directory_Set (const Ztring &NewValue);
+    Ztring Directory_Get ();
+
+private :
+    struct entry
+    {
+        std::string                         Key;
+        item                                Item;
+        size_t                              Size; //Approximate count of bytes used in memory
+    };
+    typedef std::list<entry> entries;
+    entries                                 Items; //Most recently used first
+    std::map<std::string, entries::iterator> Items_Index;
+    int64u                                  Size;
+    int64u                                  MaxSize;
+    Ztring                                  Directory;
+    size_t                                  Directory_TempCount;
+    ZenLib::CriticalSection                 CS;
+
+    void   Trim ();
+    void   Memory_Set (const std::string &Key, item &Item);
+};
+
+extern MediaInfo_Cache Cache;
+
+} //NameSpace
+
+#endif //MEDIAINFO_CACHE
+
+#endif
@@ -129,6 +129,9 @@
 #if defined(MEDIAINFO_EBUCORE_YES)
     #include "MediaInfo/Export/Export_EbuCore.h"
 #endif //defined(MEDIAINFO_EBUCORE_YES)
+#if MEDIAINFO_CACHE
+    #include "MediaInfo/MediaInfo_Cache.h"
+#endif //MEDIAINFO_CACHE
 #include <limits>
 using namespace ZenLib;
 using namespace std;
@@ -396,7 +399,11 @@ void MediaInfo_Config::Init(bool Force)
         Iso639_1.clear();
         Iso639_2.clear();
         for (size_t StreamKind=0; StreamKind<Stream_Max; StreamKind++)
+        {
+            Info_IsLoaded[StreamKind]=false;
             Info[StreamKind].clear();
+            Info_Pos[StreamKind].clear();
+        }
         SubFile_Config.clear();
         CustomMapping.clear();
         #if defined(MEDIAINFO_LIBCURL_YES)
@@ -1357,6 +1364,49 @@ Ztring MediaInfo_Config::Option (const String &Option, const String &Value_Raw)
             return __T("advanced features are disabled due to compilation options");
         #endif // MEDIAINFO_ADVANCED && defined(MEDIAINFO_FILE_YES)
     }
+    if (Option_Lower==__T("cache_maxsize"))
+    {
+        #if MEDIAINFO_CACHE
+            Cache.MaxSize_Set(((Ztring*)&Value)->To_int64u());
+            return Ztring();
+        #else //MEDIAINFO_CACHE
+            return __T("Feature disabled due to compilation options");
+        #endif //MEDIAINFO_CACHE
+    }
+    if (Option_Lower==__T("cache_maxsize_get"))
+    {
+        #if MEDIAINFO_CACHE
+            return Ztring::ToZtring(Cache.MaxSize_Get());
+        #else //MEDIAINFO_CACHE
+            return __T("Feature disabled due to compilation options");
+        #endif //MEDIAINFO_CACHE
+    }
+    if (Option_Lower==__T("cache_directory"))
+    {
+        #if MEDIAINFO_CACHE
+            Cache.Directory_Set(Value);
+            return Ztring();
+        #else //MEDIAINFO_CACHE
+            return __T("Feature disabled due to compilation options");
+        #endif //MEDIAINFO_CACHE
+    }
+    if (Option_Lower==__T("cache_directory_get"))
+    {
+        #if MEDIAINFO_CACHE
+            return Cache.Directory_Get();
+        #else //MEDIAINFO_CACHE
+            return __T("Feature disabled due to compilation options");
+        #endif //MEDIAINFO_CACHE
+    }
+    if (Option_Lower==__T("cache_clear"))
+    {
+        #if MEDIAINFO_CACHE
+            Cache.Clear();
+            return Ztring();
+        #else //MEDIAINFO_CACHE
+            return __T("Feature disabled due to compilation options");
+        #endif //MEDIAINFO_CACHE
+    }
     if (Option_Lower==__T("mpegts_maximumoffset"))
     {
         MpegTs_MaximumOffset_Set(Value==__T("-1")?(int64u)-1:((Ztring*)&Value)->To_int64u());
@@ -3087,15 +3137,22 @@ void MediaInfo_Config::Language_Set_Internal(stream_t KindOfStream)
             case Stream_Menu :      MediaInfo_Config_Menu(Info[Stream_Menu]);         Language_Set(Stream_Menu); break;
         default:;
         }
+
+    //Index of parameter names
+    if (KindOfStream>=0 && KindOfStream<Stream_Max && !Info_IsLoaded[KindOfStream])
+    {
+        Info_Pos[KindOfStream].clear();
+        for (size_t Pos=0; Pos<Info[KindOfStream].size(); Pos++)
+            if (!Info[KindOfStream][Pos].empty())
+                Info_Pos[KindOfStream].insert(std::make_pair(Info[KindOfStream][Pos][Info_Name], Pos)); //First one is kept, as with ZtringListList::Find()
+        Info_IsLoaded[KindOfStream]=true;
+    }
 }
 
 //---------------------------------------------------------------------------
 const Ztring &MediaInfo_Config::Info_Get (stream_t KindOfStream, const Ztring &Value, info_t KindOfInfo)
 {
-    Language_Set_All(KindOfStream);
-    if (KindOfStream<0 || KindOfStream>=Stream_Max)
-        return EmptyString_Get();
-    size_t Pos=Info[KindOfStream].Find(Value);
+    size_t Pos=Info_Find(KindOfStream, Value);
     if (Pos==Error || (size_t)KindOfInfo>=Info[KindOfStream][Pos].size())
         return EmptyString_Get();
     return Info[KindOfStream][Pos][KindOfInfo];
@@ -3103,10 +3160,11 @@ const Ztring &MediaInfo_Config::Info_Get (stream_t KindOfStream, const Ztring &V
 
 const Ztring &MediaInfo_Config::Info_Get (stream_t KindOfStream, size_t Pos, info_t KindOfInfo)
 {
-    Language_Set_All(KindOfStream);
-
     if (KindOfStream<0 || KindOfStream>=Stream_Max)
         return EmptyString_Get();
+    if (!Info_IsLoaded[KindOfStream])
+        Language_Set_All(KindOfStream);
+
     if (Pos>=Info[KindOfStream].size() || (size_t)KindOfInfo>=Info[KindOfStream][Pos].size())
         return EmptyString_Get();
     return Info[KindOfStream][Pos][KindOfInfo];
@@ -3116,12 +3174,25 @@ const ZtringListList &MediaInfo_Config::Info_Get(stream_t KindOfStream)
 {
     if (KindOfStream<0 || KindOfStream>=Stream_Max)
         return EmptyStringListList_Get();
-
-    Language_Set_All(KindOfStream);
+    if (!Info_IsLoaded[KindOfStream])
+        Language_Set_All(KindOfStream);
 
     return Info[KindOfStream];
 }
 
+size_t MediaInfo_Config::Info_Find (stream_t KindOfStream, const Ztring &Value)
+{
+    if (KindOfStream<0 || KindOfStream>=Stream_Max)
+        return Error;
+    if (!Info_IsLoaded[KindOfStream])
+        Language_Set_All(KindOfStream);
+
+    std::unordered_map<String, size_t>::const_iterator Item=Info_Pos[KindOfStream].find(Value);
+    if (Item==Info_Pos[KindOfStream].end())
+        return Error;
+    return Item->second;
+}
+
 //---------------------------------------------------------------------------
 Ztring MediaInfo_Config::Info_Parameters_Get (bool Complete)
 {
@@ -3191,18 +3262,7 @@ Ztring MediaInfo_Config::HideShowParameter(const Ztring &Value, Char Show)
         //Loading codec table if not yet done
         {
         CriticalSectionLocker CSL(CS);
-        if (Info[StreamKind].empty())
-            switch (StreamKind)
-            {
-                case Stream_General :   MediaInfo_Config_General(Info[Stream_General]);   Language_Set(Stream_General); break;
-                case Stream_Video :     MediaInfo_Config_Video(Info[Stream_Video]);       Language_Set(Stream_Video); break;
-                case Stream_Audio :     MediaInfo_Config_Audio(Info[Stream_Audio]);       Language_Set(Stream_Audio); break;
-                case Stream_Text :      MediaInfo_Config_Text(Info[Stream_Text]);         Language_Set(Stream_Text); break;
-                case Stream_Other :     MediaInfo_Config_Other(Info[Stream_Other]);       Language_Set(Stream_Other); break;
-                case Stream_Image :     MediaInfo_Config_Image(Info[Stream_Image]);       Language_Set(Stream_Image); break;
-                case Stream_Menu :      MediaInfo_Config_Menu(Info[Stream_Menu]);         Language_Set(Stream_Menu); break;
-                default:;
-            }
+        Language_Set_Internal(StreamKind);
         }
 
         String FieldName=List[j].substr(List[j].find(__T('_'))+1);
@@ -30,6 +30,8 @@
 #include "ZenLib/InfoMap.h"
 #include <set>
 #include <bitset>
+#include <unordered_map>
+#include <atomic>
 using namespace ZenLib;
 using std::vector;
 using std::string;
@@ -257,6 +259,7 @@ public :
     const Ztring   &Info_Get (stream_t KindOfStream, const Ztring &Value, info_t KindOfInfo=Info_Text);
     const Ztring   &Info_Get (stream_t KindOfStream, size_t Pos, info_t KindOfInfo=Info_Text);
     const ZtringListList &Info_Get(stream_t KindOfStream); //Should not be, but too difficult to hide it
+          size_t    Info_Find (stream_t KindOfStream, const Ztring &Value); //Position of the parameter in Info_Get(KindOfStream), Error if not found
 
           Ztring    Info_Parameters_Get (bool Complete=false);
           Ztring    HideShowParameter   (const Ztring &Value, ZenLib::Char Show);
@@ -530,6 +533,8 @@ private :
     InfoMap         Iso639_1;
     InfoMap         Iso639_2;
     ZtringListList  Info[Stream_Max]; //General info
+    std::unordered_map<String, size_t> Info_Pos[Stream_Max]; //Position in Info[] per parameter name
+    std::atomic<bool> Info_IsLoaded[Stream_Max];
 
     ZtringListList  SubFile_Config;
 
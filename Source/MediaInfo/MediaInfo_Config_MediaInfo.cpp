@@ -177,6 +177,7 @@ MediaInfo_Config_MediaInfo::MediaInfo_Config_MediaInfo()
         File_HighestFormat=true;
         File_ChannelLayout=true;
         File_FrameIsAlwaysComplete=false;
+        File_Profile=false;
         #if MEDIAINFO_DEMUX
             File_Demux_Unpacketize_StreamLayoutChange_Skip=false;
         #endif //MEDIAINFO_DEMUX
@@ -184,12 +185,21 @@ MediaInfo_Config_MediaInfo::MediaInfo_Config_MediaInfo()
     #if MEDIAINFO_MD5
         File_Md5=false;
     #endif //MEDIAINFO_MD5
+    #if MEDIAINFO_FINGERPRINT
+        File_Fingerprint=0;
+    #endif //MEDIAINFO_FINGERPRINT
     #if defined(MEDIAINFO_REFERENCES_YES)
         File_CheckSideCarFiles=false;
     #endif //defined(MEDIAINFO_REFERENCES_YES)
     File_TimeToLive=0;
     File_Buffer_Size_Hint_Pointer=NULL;
     File_Buffer_Read_Size=64*1024*1024;
+    #if MEDIAINFO_PREFETCH
+        File_Prefetch=0; //Opt-in
+    #endif //MEDIAINFO_PREFETCH
+    #if MEDIAINFO_MMAP
+        File_MMap=false;
+    #endif //MEDIAINFO_MMAP
     #if MEDIAINFO_AES
         Encryption_Format=Encryption_Format_None;
         Encryption_Method=Encryption_Method_None;
@@ -206,6 +216,14 @@ MediaInfo_Config_MediaInfo::MediaInfo_Config_MediaInfo()
     #if MEDIAINFO_EVENTS
         Event_CallBackFunction=NULL;
         Event_UserHandler=NULL;
+        #if MEDIAINFO_EVENTS_ASYNC
+            Event_Async_Ring=NULL;
+            Event_Async_Policy=0;
+            Event_Async_Size=1024;
+            Event_Async_Dropped=0;
+        #endif //MEDIAINFO_EVENTS_ASYNC
+        Inform_CallBackFunction=NULL;
+        Inform_UserHandler=NULL;
         SubFile_StreamID=(int64u)-1;
         ParseUndecodableFrames=false;
         Events_TimestampShift_Reference_PTS=(int64u)-1;
@@ -321,6 +339,9 @@ MediaInfo_Config_MediaInfo::~MediaInfo_Config_MediaInfo()
     delete[] File_Buffer; //File_Buffer=NULL;
     delete (std::vector<std::vector<ZtringListList> >*)File_ExpandSubs_Backup; //File_ExpandSubs_Backup=NULL
 
+    #if MEDIAINFO_EVENTS_ASYNC
+        delete Event_Async_Ring; //Event_Async_Ring=NULL; Pending events are delivered
+    #endif //MEDIAINFO_EVENTS_ASYNC
     #if MEDIAINFO_EVENTS
         for (events_delayed::iterator Event=Events_Delayed.begin(); Event!=Events_Delayed.end(); ++Event)
             for (size_t Pos=0; Pos<Event->second.size(); Pos++)
@@ -572,6 +593,15 @@ Ztring MediaInfo_Config_MediaInfo::Option (const String &Option, const String &V
             return __T("Advanced features are disabled due to compilation options");
         #endif //MEDIAINFO_ADVANCED
     }
+    else if (Option_Lower==__T("file_profile"))
+    {
+        #if MEDIAINFO_ADVANCED
+            File_Profile_Set(!(Value==__T("0") || Value.empty()));
+            return Ztring();
+        #else //MEDIAINFO_ADVANCED
+            return __T("Advanced features are disabled due to compilation options");
+        #endif //MEDIAINFO_ADVANCED
+    }
     else if (Option_Lower==__T("file_frameisalwayscomplete"))
     {
         #if MEDIAINFO_ADVANCED
@@ -603,6 +633,15 @@ Ztring MediaInfo_Config_MediaInfo::Option (const String &Option, const String &V
             return __T("MD5 is disabled due to compilation options");
         #endif //MEDIAINFO_MD5
     }
+    else if (Option_Lower==__T("file_fingerprint"))
+    {
+        #if MEDIAINFO_FINGERPRINT
+            File_Fingerprint_Set((size_t)Value.To_int64u());
+            return Ztring();
+        #else //MEDIAINFO_FINGERPRINT
+            return __T("Fingerprint is disabled due to compilation options");
+        #endif //MEDIAINFO_FINGERPRINT
+    }
     else if (Option_Lower==__T("file_hash"))
     {
         #if MEDIAINFO_HASH
@@ -741,6 +780,40 @@ Ztring MediaInfo_Config_MediaInfo::Option (const String &Option, const String &V
     {
         return Ztring::ToZtring((size_t)File_Buffer_Read_Size_Get());
     }
+    else if (Option_Lower==__T("file_prefetch"))
+    {
+        #if MEDIAINFO_PREFETCH
+            File_Prefetch_Set((size_t)Ztring(Value).To_int64u());
+            return Ztring();
+        #else //MEDIAINFO_PREFETCH
+            return __T("Prefetch is disabled due to compilation options");
+        #endif //MEDIAINFO_PREFETCH
+    }
+    else if (Option_Lower==__T("file_prefetch_get"))
+    {
+        #if MEDIAINFO_PREFETCH
+            return Ztring::ToZtring((size_t)File_Prefetch_Get());
+        #else //MEDIAINFO_PREFETCH
+            return __T("Prefetch is disabled due to compilation options");
+        #endif //MEDIAINFO_PREFETCH
+    }
+    else if (Option_Lower==__T("file_mmap"))
+    {
+        #if MEDIAINFO_MMAP
+            File_MMap_Set(!(Value==__T("0") || Value.empty()));
+            return Ztring();
+        #else //MEDIAINFO_MMAP
+            return __T("Memory mapping is disabled due to compilation options");
+        #endif //MEDIAINFO_MMAP
+    }
+    else if (Option_Lower==__T("file_mmap_get"))
+    {
+        #if MEDIAINFO_MMAP
+            return File_MMap_Get()?"1":"0";
+        #else //MEDIAINFO_MMAP
+            return __T("Memory mapping is disabled due to compilation options");
+        #endif //MEDIAINFO_MMAP
+    }
     else if (Option_Lower==__T("file_filter"))
     {
         #if MEDIAINFO_FILTER
@@ -1300,6 +1373,46 @@ Ztring MediaInfo_Config_MediaInfo::Option (const String &Option, const String &V
             return __T("Event manager is disabled due to compilation options");
         #endif //MEDIAINFO_EVENTS
     }
+    else if (Option_Lower==__T("file_event_async"))
+    {
+        #if MEDIAINFO_EVENTS_ASYNC
+            return Event_Async_Set(Value);
+        #else //MEDIAINFO_EVENTS_ASYNC
+            return __T("Asynchronous events are disabled due to compilation options");
+        #endif //MEDIAINFO_EVENTS_ASYNC
+    }
+    else if (Option_Lower==__T("file_event_async_size"))
+    {
+        #if MEDIAINFO_EVENTS_ASYNC
+            return Event_Async_Size_Set(Value);
+        #else //MEDIAINFO_EVENTS_ASYNC
+            return __T("Asynchronous events are disabled due to compilation options");
+        #endif //MEDIAINFO_EVENTS_ASYNC
+    }
+    else if (Option_Lower==__T("file_event_async_dropped_get"))
+    {
+        #if MEDIAINFO_EVENTS_ASYNC
+            return Ztring::ToZtring(Event_Async_Dropped_Get());
+        #else //MEDIAINFO_EVENTS_ASYNC
+            return __T("Asynchronous events are disabled due to compilation options");
+        #endif //MEDIAINFO_EVENTS_ASYNC
+    }
+    else if (Option_Lower==__T("file_inform_callbackfunction"))
+    {
+        #if MEDIAINFO_EVENTS
+            return Inform_CallBackFunction_Set(Value);
+        #else //MEDIAINFO_EVENTS
+            return __T("Event manager is disabled due to compilation options");
+        #endif //MEDIAINFO_EVENTS
+    }
+    else if (Option_Lower==__T("file_inform_callbackfunction_get"))
+    {
+        #if MEDIAINFO_EVENTS
+            return Inform_CallBackFunction_Get();
+        #else //MEDIAINFO_EVENTS
+            return __T("Event manager is disabled due to compilation options");
+        #endif //MEDIAINFO_EVENTS
+    }
     else
         return __T("Option not known");
 }
@@ -1845,6 +1958,23 @@ bool MediaInfo_Config_MediaInfo::File_Md5_Get ()
 }
 #endif //MEDIAINFO_MD5
 
+//---------------------------------------------------------------------------
+#if MEDIAINFO_FINGERPRINT
+void MediaInfo_Config_MediaInfo::File_Fingerprint_Set (size_t NewValue)
+{
+    if (NewValue>1024)
+        NewValue=1024; //Limit of the sampled size: 64 MiB per file
+    CriticalSectionLocker CSL(CS);
+    File_Fingerprint=NewValue;
+}
+
+size_t MediaInfo_Config_MediaInfo::File_Fingerprint_Get ()
+{
+    CriticalSectionLocker CSL(CS);
+    return File_Fingerprint;
+}
+#endif //MEDIAINFO_FINGERPRINT
+
 //---------------------------------------------------------------------------
 #if MEDIAINFO_HASH
 void MediaInfo_Config_MediaInfo::File_Hash_Set (HashWrapper::HashFunctions Funtions)
@@ -2073,6 +2203,47 @@ bool MediaInfo_Config_MediaInfo::File_HighestFormat_Get ()
 }
 #endif //MEDIAINFO_ADVANCED
 
+//---------------------------------------------------------------------------
+#if MEDIAINFO_ADVANCED
+void MediaInfo_Config_MediaInfo::File_Profile_Set (bool NewValue)
+{
+    CriticalSectionLocker CSL(CS);
+    File_Profile=NewValue;
+}
+
+bool MediaInfo_Config_MediaInfo::File_Profile_Get ()
+{
+    CriticalSectionLocker CSL(CS);
+    return File_Profile;
+}
+
+void MediaInfo_Config_MediaInfo::Profile_Add (const string &ParserName, const parser_profile &ToAdd)
+{
+    CriticalSectionLocker CSL(CS);
+    parser_profile &Profile=Profiles[ParserName];
+    Profile.Instances+=ToAdd.Instances;
+    Profile.Calls+=ToAdd.Calls;
+    Profile.Time_Wall+=ToAdd.Time_Wall;
+    Profile.Time_CPU+=ToAdd.Time_CPU;
+    Profile.Bytes+=ToAdd.Bytes;
+    Profile.Seeks+=ToAdd.Seeks;
+    Profile.Buffer_Reallocations+=ToAdd.Buffer_Reallocations;
+    Profile.SubParsers+=ToAdd.SubParsers;
+}
+
+std::map<std::string, MediaInfo_Config_MediaInfo::parser_profile> MediaInfo_Config_MediaInfo::Profile_Get ()
+{
+    CriticalSectionLocker CSL(CS);
+    return Profiles;
+}
+
+void MediaInfo_Config_MediaInfo::Profile_Clear ()
+{
+    CriticalSectionLocker CSL(CS);
+    Profiles.clear();
+}
+#endif //MEDIAINFO_ADVANCED
+
 //---------------------------------------------------------------------------
 #if MEDIAINFO_DEMUX
 #if MEDIAINFO_ADVANCED
@@ -2227,6 +2398,36 @@ size_t  MediaInfo_Config_MediaInfo::File_Buffer_Read_Size_Get ()
     return File_Buffer_Read_Size;
 }
 
+//---------------------------------------------------------------------------
+#if MEDIAINFO_PREFETCH
+void MediaInfo_Config_MediaInfo::File_Prefetch_Set (size_t NewValue)
+{
+    CriticalSectionLocker CSL(CS);
+    File_Prefetch=NewValue;
+}
+
+size_t  MediaInfo_Config_MediaInfo::File_Prefetch_Get ()
+{
+    CriticalSectionLocker CSL(CS);
+    return File_Prefetch;
+}
+#endif //MEDIAINFO_PREFETCH
+
+//---------------------------------------------------------------------------
+#if MEDIAINFO_MMAP
+void MediaInfo_Config_MediaInfo::File_MMap_Set (bool NewValue)
+{
+    CriticalSectionLocker CSL(CS);
+    File_MMap=NewValue;
+}
+
+bool MediaInfo_Config_MediaInfo::File_MMap_Get ()
+{
+    CriticalSectionLocker CSL(CS);
+    return File_MMap;
+}
+#endif //MEDIAINFO_MMAP
+
 //***************************************************************************
 // Filter
 //***************************************************************************
@@ -2901,6 +3102,10 @@ Ztring MediaInfo_Config_MediaInfo::Event_CallBackFunction_Set (const Ztring &Val
 
     CriticalSectionLocker CSL(CS);
 
+    #if MEDIAINFO_EVENTS_ASYNC
+        Event_Async_Reset(); //The ring calls the previous function
+    #endif //MEDIAINFO_EVENTS_ASYNC
+
     if (List.empty())
     {
         Event_CallBackFunction=(MediaInfo_Event_CallBackFunction*)NULL;
@@ -2933,6 +3138,81 @@ Ztring MediaInfo_Config_MediaInfo::Event_CallBackFunction_Get ()
 }
 #endif //MEDIAINFO_EVENTS
 
+//---------------------------------------------------------------------------
+#if MEDIAINFO_EVENTS_ASYNC
+Ztring MediaInfo_Config_MediaInfo::Event_Async_Set (const Ztring &Value)
+{
+    Ztring Value_Lower(Value);
+    Value_Lower.MakeLowerCase();
+    int8u Policy;
+    if (Value_Lower.empty() || Value_Lower==__T("0"))
+        Policy=0;
+    else if (Value_Lower==__T("1") || Value_Lower==__T("block"))
+        Policy=1+MediaInfo_Events_Ring::Policy_Block;
+    else if (Value_Lower==__T("drop_oldest"))
+        Policy=1+MediaInfo_Events_Ring::Policy_DropOldest;
+    else if (Value_Lower==__T("drop_newest"))
+        Policy=1+MediaInfo_Events_Ring::Policy_DropNewest;
+    else
+        return __T("Invalid value");
+
+    CriticalSectionLocker CSL(CS);
+    Event_Async_Reset();
+    Event_Async_Policy=Policy;
+    return Ztring();
+}
+#endif //MEDIAINFO_EVENTS_ASYNC
+
+//---------------------------------------------------------------------------
+#if MEDIAINFO_EVENTS_ASYNC
+Ztring MediaInfo_Config_MediaInfo::Event_Async_Size_Set (const Ztring &Value)
+{
+    int64u Size=Value.To_int64u();
+    if (!Size)
+        return __T("Invalid value");
+
+    CriticalSectionLocker CSL(CS);
+    Event_Async_Reset();
+    Event_Async_Size=(size_t)Size;
+    return Ztring();
+}
+#endif //MEDIAINFO_EVENTS_ASYNC
+
+//---------------------------------------------------------------------------
+#if MEDIAINFO_EVENTS_ASYNC
+int64u MediaInfo_Config_MediaInfo::Event_Async_Dropped_Get ()
+{
+    CriticalSectionLocker CSL(CS);
+    return Event_Async_Dropped+(Event_Async_Ring?Event_Async_Ring->Dropped_Get():0);
+}
+#endif //MEDIAINFO_EVENTS_ASYNC
+
+//---------------------------------------------------------------------------
+#if MEDIAINFO_EVENTS_ASYNC
+void MediaInfo_Config_MediaInfo::Event_Async_Flush ()
+{
+    //Not under CS, the callback may use the API during the flush. The ring is created and deleted by the parsing thread only
+    MediaInfo_Events_Ring* Ring;
+    {
+    CriticalSectionLocker CSL(CS);
+    Ring=Event_Async_Ring;
+    }
+    if (Ring)
+        Ring->Flush();
+}
+#endif //MEDIAINFO_EVENTS_ASYNC
+
+//---------------------------------------------------------------------------
+#if MEDIAINFO_EVENTS_ASYNC
+void MediaInfo_Config_MediaInfo::Event_Async_Reset ()
+{
+    if (!Event_Async_Ring)
+        return;
+    Event_Async_Dropped+=Event_Async_Ring->Dropped_Get();
+    delete Event_Async_Ring; Event_Async_Ring=NULL;
+}
+#endif //MEDIAINFO_EVENTS_ASYNC
+
 //---------------------------------------------------------------------------
 #if MEDIAINFO_EVENTS
 void MediaInfo_Config_MediaInfo::Event_Send (File__Analyze* Source, const int8u* Data_Content, size_t Data_Size, const Ztring &File_Name)
@@ -3187,6 +3467,27 @@ void MediaInfo_Config_MediaInfo::Event_Send (File__Analyze* Source, const int8u*
     }
     else if (Event_CallBackFunction)
     {
+        #if MEDIAINFO_EVENTS_ASYNC
+            //Delivery on the ring thread, events of referenced files and per packet parsing stay synchronous
+            #if MEDIAINFO_NEXTPACKET
+                bool Event_Async=Event_Async_Policy && !FileIsReferenced && !NextPacket;
+            #else //MEDIAINFO_NEXTPACKET
+                bool Event_Async=Event_Async_Policy && !FileIsReferenced;
+            #endif //MEDIAINFO_NEXTPACKET
+            if (Event_Async)
+            {
+                if (!Event_Async_Ring)
+                    Event_Async_Ring=new MediaInfo_Events_Ring(Event_CallBackFunction, Event_UserHandler, (MediaInfo_Events_Ring::policy)(Event_Async_Policy-1), Event_Async_Size);
+                if (Event_Async_Ring->Push(Data_Content, Data_Size))
+                {
+                    if (((((MediaInfo_Event_Generic*)Data_Content)->EventCode>>8)&0xFFFF)==MediaInfo_Event_General_SubFile_Start)
+                        Event_Async_Ring->Flush(); //Events of the referenced file are sent synchronously, after this one
+                    return;
+                }
+                Event_Async_Ring->Flush(); //Event which can not be copied, sent after the pending ones
+            }
+        #endif //MEDIAINFO_EVENTS_ASYNC
+
         MEDIAINFO_DEBUG1(   "CallBackFunction",
                             Debug+=", EventID=";Debug+=Ztring::ToZtring(LittleEndian2int32u(Data_Content), 16).To_UTF8();)
 
@@ -3412,6 +3713,76 @@ void MediaInfo_Config_MediaInfo::Event_SubFile_Missing_Absolute(const Ztring &Fi
 }
 #endif //MEDIAINFO_EVENTS
 
+//***************************************************************************
+// Inform output
+//***************************************************************************
+
+//---------------------------------------------------------------------------
+#if MEDIAINFO_EVENTS
+bool MediaInfo_Config_MediaInfo::Inform_CallBackFunction_IsSet ()
+{
+    CriticalSectionLocker CSL(CS);
+
+    return Inform_CallBackFunction?true:false;
+}
+#endif //MEDIAINFO_EVENTS
+
+//---------------------------------------------------------------------------
+#if MEDIAINFO_EVENTS
+Ztring MediaInfo_Config_MediaInfo::Inform_CallBackFunction_Set (const Ztring &Value)
+{
+    ZtringList List=Value;
+
+    CriticalSectionLocker CSL(CS);
+
+    if (List.empty())
+    {
+        Inform_CallBackFunction=(MediaInfo_Inform_CallBackFunction*)NULL;
+        Inform_UserHandler=NULL;
+    }
+    else
+        for (size_t Pos=0; Pos<List.size(); Pos++)
+        {
+            if (List[Pos].find(__T("CallBack=memory://"))==0)
+                Inform_CallBackFunction=(MediaInfo_Inform_CallBackFunction*)Ztring(List[Pos].substr(18, std::string::npos)).To_int64u();
+            else if (List[Pos].find(__T("UserHandler=memory://"))==0)
+                Inform_UserHandler=(void*)Ztring(List[Pos].substr(21, std::string::npos)).To_int64u();
+            else
+                return("Problem during Inform_CallBackFunction value parsing");
+        }
+
+    return Ztring();
+}
+#endif //MEDIAINFO_EVENTS
+
+//---------------------------------------------------------------------------
+#if MEDIAINFO_EVENTS
+Ztring MediaInfo_Config_MediaInfo::Inform_CallBackFunction_Get ()
+{
+    CriticalSectionLocker CSL(CS);
+
+    return __T("CallBack=memory://")+Ztring::ToZtring((size_t)Inform_CallBackFunction)+__T(";UserHandler=memory://")+Ztring::ToZtring((size_t)Inform_UserHandler);
+}
+#endif //MEDIAINFO_EVENTS
+
+//---------------------------------------------------------------------------
+#if MEDIAINFO_EVENTS
+void MediaInfo_Config_MediaInfo::Inform_Send (const char* Data_Content, size_t Data_Size)
+{
+    MediaInfo_Inform_CallBackFunction* CallBackFunction;
+    void* UserHandler;
+    {
+        CriticalSectionLocker CSL(CS);
+        CallBackFunction=Inform_CallBackFunction;
+        UserHandler=Inform_UserHandler;
+    }
+
+    //Not under the lock, the handler may call Option()
+    if (CallBackFunction && Data_Size)
+        CallBackFunction((const unsigned char*)Data_Content, Data_Size, UserHandler);
+}
+#endif //MEDIAINFO_EVENTS
+
 //***************************************************************************
 // Force Parser
 //***************************************************************************
@@ -28,6 +28,9 @@
     #include "MediaInfo/MediaInfo_Events.h"
     #include "ZenLib/File.h"
 #endif //MEDIAINFO_EVENTS
+#if MEDIAINFO_EVENTS_ASYNC
+    #include "MediaInfo/MediaInfo_Events_Ring.h"
+#endif //MEDIAINFO_EVENTS_ASYNC
 #include "ZenLib/CriticalSection.h"
 #include "ZenLib/Translation.h"
 #include "ZenLib/InfoMap.h"
@@ -191,6 +194,8 @@ public :
         bool          File_ChannelLayout_Get();
         void          File_FrameIsAlwaysComplete_Set(bool NewValue) { File_FrameIsAlwaysComplete = NewValue; }
         bool          File_FrameIsAlwaysComplete_Get() { return File_FrameIsAlwaysComplete; }
+        void          File_Profile_Set (bool NewValue);
+        bool          File_Profile_Get ();
 #endif //MEDIAINFO_ADVANCED
 
     #if MEDIAINFO_DEMUX
@@ -208,6 +213,10 @@ public :
         void          File_Md5_Set (bool NewValue);
         bool          File_Md5_Get ();
     #endif //MEDIAINFO_MD5
+    #if MEDIAINFO_FINGERPRINT
+        void          File_Fingerprint_Set (size_t NewValue);
+        size_t        File_Fingerprint_Get ();
+    #endif //MEDIAINFO_FINGERPRINT
 
     #if defined(MEDIAINFO_REFERENCES_YES)
         void          File_CheckSideCarFiles_Set (bool NewValue);
@@ -239,6 +248,16 @@ public :
     void          File_Buffer_Read_Size_Set (size_t NewValue);
     size_t        File_Buffer_Read_Size_Get ();
 
+    #if MEDIAINFO_PREFETCH
+    void          File_Prefetch_Set (size_t NewValue);
+    size_t        File_Prefetch_Get ();
+    #endif //MEDIAINFO_PREFETCH
+
+    #if MEDIAINFO_MMAP
+    void          File_MMap_Set (bool NewValue);
+    bool          File_MMap_Get ();
+    #endif //MEDIAINFO_MMAP
+
     #if MEDIAINFO_AES
     void          Encryption_Format_Set (const Ztring &Value);
     void          Encryption_Format_Set (encryption_format Value);
@@ -312,6 +331,20 @@ public :
     void          Event_SubFile_Missing_Absolute(const Ztring &FileName_Absolute);
     #endif //MEDIAINFO_EVENTS
 
+    #if MEDIAINFO_EVENTS_ASYNC
+    Ztring        Event_Async_Set (const Ztring &Value);
+    Ztring        Event_Async_Size_Set (const Ztring &Value);
+    int64u        Event_Async_Dropped_Get ();
+    void          Event_Async_Flush ();
+    #endif //MEDIAINFO_EVENTS_ASYNC
+
+    #if MEDIAINFO_EVENTS
+    bool          Inform_CallBackFunction_IsSet ();
+    Ztring        Inform_CallBackFunction_Set (const Ztring &Value);
+    Ztring        Inform_CallBackFunction_Get ();
+    void          Inform_Send (const char* Data_Content, size_t Data_Size);
+    #endif //MEDIAINFO_EVENTS
+
     void          Demux_Rate_Set (float64 NewValue);
     float64       Demux_Rate_Get ();
     #if MEDIAINFO_DEMUX
@@ -458,6 +491,9 @@ public :
     #if MEDIAINFO_SEEK
     bool      File_GoTo_IsFrameOffset;
     #endif //MEDIAINFO_SEEK
+    #if MEDIAINFO_PREFETCH
+    std::vector<std::pair<int64u, int64u> > File_Prefetch_Hints; //Offset and size of data the parser will jump to later
+    #endif //MEDIAINFO_PREFETCH
 
     //Logs
     #if MEDIAINFO_ADVANCED
@@ -471,6 +507,20 @@ public :
             string Attributes_Last;
         };
         std::map<std::string, timecode_dump>* TimeCode_Dumps;
+        struct parser_profile
+        {
+            int64u Instances=0;
+            int64u Calls=0;
+            int64u Time_Wall=0; //In microseconds, time spent in sub-parsers excluded
+            int64u Time_CPU=0;  //In microseconds, time spent in sub-parsers excluded
+            int64u Bytes=0;
+            int64u Seeks=0;
+            int64u Buffer_Reallocations=0;
+            int64u SubParsers=0;
+        };
+        void          Profile_Add (const std::string &ParserName, const parser_profile &ToAdd);
+        std::map<std::string, parser_profile> Profile_Get ();
+        void          Profile_Clear ();
     #endif //MEDIAINFO_ADVANCED
 
 private :
@@ -501,6 +551,8 @@ private :
         bool                File_HighestFormat;
         bool                File_ChannelLayout;
         bool                File_FrameIsAlwaysComplete;
+        bool                File_Profile;
+        std::map<std::string, parser_profile> Profiles;
         #if MEDIAINFO_DEMUX
             bool                File_Demux_Unpacketize_StreamLayoutChange_Skip;
         #endif //MEDIAINFO_DEMUX
@@ -511,6 +563,9 @@ private :
     #if MEDIAINFO_MD5
         bool                File_Md5;
     #endif //MEDIAINFO_MD5
+    #if MEDIAINFO_FINGERPRINT
+        size_t              File_Fingerprint;
+    #endif //MEDIAINFO_FINGERPRINT
     #if defined(MEDIAINFO_REFERENCES_YES)
         bool                File_CheckSideCarFiles;
     #endif //defined(MEDIAINFO_REFERENCES_YES)
@@ -523,6 +578,12 @@ private :
     Ztring                  File_ForceParser_Config;
     size_t*                 File_Buffer_Size_Hint_Pointer;
     size_t                  File_Buffer_Read_Size;
+    #if MEDIAINFO_PREFETCH
+    size_t                  File_Prefetch;
+    #endif //MEDIAINFO_PREFETCH
+    #if MEDIAINFO_MMAP
+    bool                    File_MMap;
+    #endif //MEDIAINFO_MMAP
 
     //Extra
     #if MEDIAINFO_AES
@@ -574,6 +635,8 @@ private :
     typedef std::map<File__Analyze*, std::vector<event_delayed*> > events_delayed;
     events_delayed Events_Delayed;
     void*                   Event_UserHandler;
+    MediaInfo_Inform_CallBackFunction* Inform_CallBackFunction; //void Inform_Handler(const unsigned char* Data_Content, size_t Data_Size, void* UserHandler)
+    void*                   Inform_UserHandler;
     ZtringListList          SubFile_Config;
     int64u                  SubFile_StreamID;
     bool                    ParseUndecodableFrames;
@@ -582,6 +645,13 @@ private :
     int64u                      Events_TimestampShift_Reference_ID;
     std::vector<event_delayed*> Events_TimestampShift_Delayed;
     #endif //MEDIAINFO_EVENTS
+    #if MEDIAINFO_EVENTS_ASYNC
+    MediaInfo_Events_Ring*  Event_Async_Ring; //Created with the first event
+    int8u                   Event_Async_Policy; //0=synchronous, else MediaInfo_Events_Ring::policy+1
+    size_t                  Event_Async_Size;
+    int64u                  Event_Async_Dropped; //From previous rings
+    void                    Event_Async_Reset ();
+    #endif //MEDIAINFO_EVENTS_ASYNC
 
     float64                 Demux_Rate;
     #if MEDIAINFO_DEMUX
@@ -196,6 +196,7 @@ extern "C"
 #endif /* __cplusplus */
 
     typedef void (__stdcall MediaInfo_Event_CallBackFunction)(unsigned char* Data_Content, size_t Data_Size, void* UserHandler);
+    typedef void (__stdcall MediaInfo_Inform_CallBackFunction)(const unsigned char* Data_Content, size_t Data_Size, void* UserHandler); /* UTF-8 output, called as soon as a chunk is available */
 
 #ifdef __cplusplus
 }
@@ -470,6 +471,24 @@ struct MediaInfo_Event_General_WaitForMoreData_End_0
     MediaInfo_int8u         Flags;              //bit 0: Outcome (1 is giving up)
 };
 
+/*-------------------------------------------------------------------------*/
+/* Profile                                                                 */
+/* Sent at the end of the parsing, one per parser, if "Profile" is set     */
+#define MediaInfo_Event_General_Profile 0x700A
+struct MediaInfo_Event_General_Profile_0
+{
+    MEDIAINFO_EVENT_GENERIC
+    const char*             ParserName;
+    MediaInfo_int64u        Instances;
+    MediaInfo_int64u        Calls;
+    MediaInfo_int64u        Time_Wall;          //In microseconds, time spent in sub-parsers excluded
+    MediaInfo_int64u        Time_CPU;           //In microseconds, time spent in sub-parsers excluded
+    MediaInfo_int64u        Bytes;
+    MediaInfo_int64u        Seeks;
+    MediaInfo_int64u        Buffer_Reallocations;
+    MediaInfo_int64u        SubParsers;
+};
+
 /***************************************************************************/
 /* MPEG-TS / BDAV / TSP                                                    */
 /***************************************************************************/
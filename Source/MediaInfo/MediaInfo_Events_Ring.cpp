@@ -0,0 +1,416 @@
+/*  Copyright (c) MediaArea.net SARL. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license that can
+ *  be found in the License.html file in the root of the source tree.
+ */
+
+//---------------------------------------------------------------------------
+// Pre-compilation
+#include "MediaInfo/PreComp.h"
+#ifdef __BORLANDC__
+    #pragma hdrstop
+#endif
+//---------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------
+#include "MediaInfo/Setup.h"
+//---------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------
+#if MEDIAINFO_EVENTS_ASYNC
+//---------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------
+#include "MediaInfo/MediaInfo_Events_Ring.h"
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <cwchar>
+#include <vector>
+using namespace std;
+//---------------------------------------------------------------------------
+
+namespace MediaInfoLib
+{
+
+//***************************************************************************
+// Copy of events
+//***************************************************************************
+
+//---------------------------------------------------------------------------
+// The event and the content it points to are copied in a single block, the
+// pointers of the copy point inside the block.
+class event_copy
+{
+public :
+    event_copy (const int8u* Data_Content, size_t Data_Size)
+        : Buffer(Data_Content, Data_Content+Data_Size)
+    {
+    }
+
+    size_t Add (size_t Pointer_Offset, const void* Content, size_t Content_Size)
+    {
+        if (!Content)
+            return (size_t)-1; //NULL in the copy too
+        Buffer.resize((Buffer.size()+7)&~((size_t)7));
+        size_t Content_Offset=Buffer.size();
+        Buffer.insert(Buffer.end(), (const int8u*)Content, (const int8u*)Content+Content_Size);
+        Pointers.push_back(make_pair(Pointer_Offset, Content_Offset));
+        return Content_Offset;
+    }
+
+    void Add_String (size_t Pointer_Offset, const char* Content)
+    {
+        if (Content)
+            Add(Pointer_Offset, Content, strlen(Content)+1);
+    }
+
+    void Add_String (size_t Pointer_Offset, const wchar_t* Content)
+    {
+        if (Content)
+            Add(Pointer_Offset, Content, (wcslen(Content)+1)*sizeof(wchar_t));
+    }
+
+    int8u* Get ()
+    {
+        int8u* Block=new int8u[Buffer.size()];
+        memcpy(Block, &Buffer[0], Buffer.size());
+        for (size_t Pos=0; Pos<Pointers.size(); Pos++)
+        {
+            int8u* Content=Block+Pointers[Pos].second;
+            memcpy(Block+Pointers[Pos].first, &Content, sizeof(Content));
+        }
+        return Block;
+    }
+
+private :
+    vector<int8u>                   Buffer;
+    vector<pair<size_t, size_t> >   Pointers; //Offset of the pointer, offset of the content
+};
+
+//---------------------------------------------------------------------------
+#define EVENT_IS(_EVENT, _VERSION) \
+    (EventID==MediaInfo_Event_##_EVENT && EventVersion==_VERSION && Data_Size>=sizeof(MediaInfo_Event_##_EVENT##_##_VERSION))
+#define EVENT_ADD(_EVENT, _VERSION, _MEMBER, _SIZE) \
+    Copy.Add(offsetof(MediaInfo_Event_##_EVENT##_##_VERSION, _MEMBER), ((const MediaInfo_Event_##_EVENT##_##_VERSION*)Data_Content)->_MEMBER, _SIZE)
+#define EVENT_ADD_STRING(_EVENT, _VERSION, _MEMBER) \
+    Copy.Add_String(offsetof(MediaInfo_Event_##_EVENT##_##_VERSION, _MEMBER), ((const MediaInfo_Event_##_EVENT##_##_VERSION*)Data_Content)->_MEMBER)
+
+//---------------------------------------------------------------------------
+static int8u* Event_Copy (const int8u* Data_Content, size_t Data_Size)
+{
+    if (Data_Size<sizeof(int32u))
+        return NULL;
+    int32u EventCode;
+    memcpy(&EventCode, Data_Content, sizeof(EventCode));
+    int32u EventID=(EventCode>>8)&0xFFFF;
+    int8u EventVersion=(int8u)EventCode;
+    event_copy Copy(Data_Content, Data_Size);
+
+    if (EVENT_IS(Log, 0))
+    {
+        EVENT_ADD_STRING(Log, 0, MessageString);
+        EVENT_ADD_STRING(Log, 0, MessageStringU);
+        EVENT_ADD_STRING(Log, 0, MessageStringA);
+    }
+    else if (EVENT_IS(Global_Demux, 4))
+    {
+        const MediaInfo_Event_Global_Demux_4* Event=(const MediaInfo_Event_Global_Demux_4*)Data_Content;
+        EVENT_ADD(Global_Demux, 4, Content, Event->Content_Size);
+        EVENT_ADD(Global_Demux, 4, Offsets_Stream, Event->Offsets_Size*sizeof(MediaInfo_int64u));
+        EVENT_ADD(Global_Demux, 4, Offsets_Content, Event->Offsets_Size*sizeof(MediaInfo_int64u));
+        EVENT_ADD(Global_Demux, 4, OriginalContent, Event->OriginalContent_Size);
+    }
+    else if (EVENT_IS(Global_SimpleText, 0))
+    {
+        const MediaInfo_Event_Global_SimpleText_0* Event=(const MediaInfo_Event_Global_SimpleText_0*)Data_Content;
+        EVENT_ADD_STRING(Global_SimpleText, 0, Content);
+        size_t Rows=EVENT_ADD(Global_SimpleText, 0, Row_Values, Event->Row_Max*sizeof(wchar_t*));
+        if (Rows!=(size_t)-1)
+            for (size_t Row_Pos=0; Row_Pos<Event->Row_Max; Row_Pos++)
+                Copy.Add(Rows+Row_Pos*sizeof(wchar_t*), Event->Row_Values[Row_Pos], (Event->Column_Max+1)*sizeof(wchar_t)); //Row ends with \0
+        Rows=EVENT_ADD(Global_SimpleText, 0, Row_Attributes, Event->Row_Max*sizeof(MediaInfo_int8u*));
+        if (Rows!=(size_t)-1)
+            for (size_t Row_Pos=0; Row_Pos<Event->Row_Max; Row_Pos++)
+                Copy.Add(Rows+Row_Pos*sizeof(MediaInfo_int8u*), Event->Row_Attributes[Row_Pos], Event->Column_Max);
+    }
+    else if (EVENT_IS(Global_BytesRead, 0))
+        EVENT_ADD(Global_BytesRead, 0, Content, ((const MediaInfo_Event_Global_BytesRead_0*)Data_Content)->Content_Size);
+    else if (EVENT_IS(Global_Decoded, 0))
+        EVENT_ADD(Global_Decoded, 0, Content, ((const MediaInfo_Event_Global_Decoded_0*)Data_Content)->Content_Size);
+    else if (EVENT_IS(Global_AttachedFile, 0))
+    {
+        EVENT_ADD(Global_AttachedFile, 0, Content, ((const MediaInfo_Event_Global_AttachedFile_0*)Data_Content)->Content_Size);
+        EVENT_ADD_STRING(Global_AttachedFile, 0, Name);
+        EVENT_ADD_STRING(Global_AttachedFile, 0, MimeType);
+        EVENT_ADD_STRING(Global_AttachedFile, 0, Description);
+    }
+    else if (EVENT_IS(General_Start, 0))
+    {
+        EVENT_ADD_STRING(General_Start, 0, FileName);
+        EVENT_ADD_STRING(General_Start, 0, FileName_Unicode);
+    }
+    else if (EVENT_IS(General_SubFile_Start, 0) || EVENT_IS(General_SubFile_Missing, 0)) //Same layout
+    {
+        EVENT_ADD_STRING(General_SubFile_Start, 0, FileName_Relative);
+        EVENT_ADD_STRING(General_SubFile_Start, 0, FileName_Relative_Unicode);
+        EVENT_ADD_STRING(General_SubFile_Start, 0, FileName_Absolute);
+        EVENT_ADD_STRING(General_SubFile_Start, 0, FileName_Absolute_Unicode);
+    }
+    else if (EVENT_IS(General_Profile, 0))
+        EVENT_ADD_STRING(General_Profile, 0, ParserName);
+    else if (EVENT_IS(DvDif_Analysis_Frame, 0))
+        EVENT_ADD_STRING(DvDif_Analysis_Frame, 0, Errors);
+    else if (EVENT_IS(DvDif_Analysis_Frame, 1))
+    {
+        const MediaInfo_Event_DvDif_Analysis_Frame_1* Event=(const MediaInfo_Event_DvDif_Analysis_Frame_1*)Data_Content;
+        EVENT_ADD_STRING(DvDif_Analysis_Frame, 1, Errors);
+        EVENT_ADD(DvDif_Analysis_Frame, 1, Video_STA_Errors, Event->Video_STA_Errors_Count*sizeof(size_t));
+        EVENT_ADD(DvDif_Analysis_Frame, 1, Audio_Data_Errors, Event->Audio_Data_Errors_Count*sizeof(size_t));
+        EVENT_ADD(DvDif_Analysis_Frame, 1, BlockStatus, Event->BlockStatus_Count);
+        if (Event->MoreData)
+            EVENT_ADD(DvDif_Analysis_Frame, 1, MoreData, sizeof(size_t)+*((const size_t*)Event->MoreData)); //Size then content
+    }
+    else if (EVENT_IS(DvDif_Change, 0))
+    {
+        const MediaInfo_Event_DvDif_Change_0* Event=(const MediaInfo_Event_DvDif_Change_0*)Data_Content;
+        if (Event->MoreData)
+            EVENT_ADD(DvDif_Change, 0, MoreData, sizeof(size_t)+*((const size_t*)Event->MoreData)); //Size then content
+    }
+    else if (EventID==MediaInfo_Event_Log
+          || EventID==MediaInfo_Event_Global_Demux
+          || EventID==MediaInfo_Event_Global_SimpleText
+          || EventID==MediaInfo_Event_Global_BytesRead
+          || EventID==MediaInfo_Event_Global_Decoded
+          || EventID==MediaInfo_Event_Global_AttachedFile
+          || EventID==MediaInfo_Event_General_Start
+          || EventID==MediaInfo_Event_General_SubFile_Start
+          || EventID==MediaInfo_Event_General_SubFile_Missing
+          || EventID==MediaInfo_Event_General_Profile
+          || EventID==MediaInfo_Event_DvDif_Analysis_Frame
+          || EventID==MediaInfo_Event_DvDif_Change)
+        return NULL; //Unknown version of an event with pointers
+    //Other events have no pointers
+
+    return Copy.Get();
+}
+
+//***************************************************************************
+// Constructor/Destructor
+//***************************************************************************
+
+//---------------------------------------------------------------------------
+MediaInfo_Events_Ring::MediaInfo_Events_Ring(MediaInfo_Event_CallBackFunction* CallBackFunction_, void* UserHandler_, policy Policy_, size_t Size)
+{
+    //Ring, power of 2
+    size_t Slots_Count=2;
+    while (Slots_Count<Size && Slots_Count<0x100000)
+        Slots_Count<<=1;
+    Slots=new slot[Slots_Count];
+    for (size_t Pos=0; Pos<Slots_Count; Pos++)
+        Slots[Pos].Sequence.store(Pos, memory_order_relaxed);
+    Mask=Slots_Count-1;
+    Enqueue_Pos=0;
+    Dequeue_Pos.store(0);
+
+    //Delivery
+    CallBackFunction=CallBackFunction_;
+    UserHandler=UserHandler_;
+    Policy=Policy_;
+    Pushed=0;
+    Done.store(0);
+    Dropped.store(0);
+
+    //Consumer, events are delivered synchronously if the thread can not be created
+    Consumer_IsWaiting.store(false);
+    Consumer_Terminate.store(false);
+    Producer_IsWaiting.store(false);
+    try
+    {
+        Consumer=thread(&MediaInfo_Events_Ring::Consume, this);
+    }
+    catch (...)
+    {
+    }
+}
+
+//---------------------------------------------------------------------------
+MediaInfo_Events_Ring::~MediaInfo_Events_Ring()
+{
+    if (Consumer.joinable())
+    {
+        Flush();
+        Consumer_Terminate.store(true);
+        Consumer_Wake();
+        Consumer.join();
+    }
+    delete[] Slots;
+}
+
+//***************************************************************************
+// Producer
+//***************************************************************************
+
+//---------------------------------------------------------------------------
+bool MediaInfo_Events_Ring::Push (const int8u* Data_Content, size_t Data_Size)
+{
+    if (!Consumer.joinable())
+        return false;
+    int8u* Copy=Event_Copy(Data_Content, Data_Size);
+    if (!Copy)
+        return false;
+
+    while (!Enqueue(Copy, Data_Size))
+    {
+        switch (Policy)
+        {
+            case Policy_Block :
+                                {
+                                //The timeout covers a wake-up sent just before the wait
+                                unique_lock<mutex> Lock(Producer_Mutex);
+                                Producer_IsWaiting.store(true);
+                                Consumer_Wake();
+                                Producer_Condition.wait_for(Lock, chrono::milliseconds(10), [this]{return Slots[Enqueue_Pos&Mask].Sequence.load(memory_order_acquire)==Enqueue_Pos;});
+                                Producer_IsWaiting.store(false);
+                                }
+                                break;
+            case Policy_DropOldest :
+                                {
+                                int8u* Old_Content;
+                                size_t Old_Size;
+                                if (Dequeue(Old_Content, Old_Size))
+                                {
+                                    delete[] Old_Content;
+                                    Dropped++;
+                                    Done++;
+                                }
+                                }
+                                break;
+            default :
+                                delete[] Copy;
+                                Dropped++;
+                                return true;
+        }
+    }
+    Pushed++;
+
+    Consumer_Wake();
+    return true;
+}
+
+//---------------------------------------------------------------------------
+void MediaInfo_Events_Ring::Flush ()
+{
+    //The timeout covers a wake-up sent just before the wait
+    unique_lock<mutex> Lock(Producer_Mutex);
+    while (Done.load(memory_order_acquire)!=Pushed)
+    {
+        Producer_IsWaiting.store(true);
+        Consumer_Wake();
+        Producer_Condition.wait_for(Lock, chrono::milliseconds(10));
+    }
+    Producer_IsWaiting.store(false);
+}
+
+//***************************************************************************
+// Ring
+//***************************************************************************
+
+//---------------------------------------------------------------------------
+// Bounded queue with a sequence number per slot: a slot is writable when
+// its sequence is the enqueue position, readable when it is the dequeue
+// position + 1. Readers claim a position with a compare-exchange so the
+// producer can discard the oldest event while the consumer reads.
+bool MediaInfo_Events_Ring::Enqueue (int8u* Data_Content, size_t Data_Size)
+{
+    slot &Slot=Slots[Enqueue_Pos&Mask];
+    if (Slot.Sequence.load(memory_order_acquire)!=Enqueue_Pos)
+        return false; //Full
+    Slot.Data_Content=Data_Content;
+    Slot.Data_Size=Data_Size;
+    Slot.Sequence.store(Enqueue_Pos+1, memory_order_release);
+    Enqueue_Pos++;
+    return true;
+}
+
+//---------------------------------------------------------------------------
+bool MediaInfo_Events_Ring::Dequeue (int8u* &Data_Content, size_t &Data_Size)
+{
+    size_t Pos=Dequeue_Pos.load(memory_order_relaxed);
+    for (;;)
+    {
+        slot &Slot=Slots[Pos&Mask];
+        ptrdiff_t Diff=(ptrdiff_t)(Slot.Sequence.load(memory_order_acquire)-(Pos+1));
+        if (!Diff)
+        {
+            if (Dequeue_Pos.compare_exchange_weak(Pos, Pos+1, memory_order_relaxed))
+            {
+                Data_Content=Slot.Data_Content;
+                Data_Size=Slot.Data_Size;
+                Slot.Sequence.store(Pos+Mask+1, memory_order_release);
+                return true;
+            }
+        }
+        else if (Diff<0)
+            return false; //Empty
+        else
+            Pos=Dequeue_Pos.load(memory_order_relaxed);
+    }
+}
+
+//***************************************************************************
+// Consumer
+//***************************************************************************
+
+//---------------------------------------------------------------------------
+void MediaInfo_Events_Ring::Consume ()
+{
+    for (;;)
+    {
+        int8u* Data_Content;
+        size_t Data_Size;
+        if (Dequeue(Data_Content, Data_Size))
+        {
+            CallBackFunction((unsigned char*)Data_Content, Data_Size, UserHandler);
+            delete[] Data_Content;
+            Done.fetch_add(1, memory_order_release);
+            Producer_Wake();
+            continue;
+        }
+        if (Consumer_Terminate.load())
+            return;
+
+        //Nothing to do, the timeout covers a wake-up sent just before the wait
+        unique_lock<mutex> Lock(Consumer_Mutex);
+        Consumer_IsWaiting.store(true);
+        if (Slots[Dequeue_Pos.load()&Mask].Sequence.load(memory_order_acquire)==Dequeue_Pos.load()+1 || Consumer_Terminate.load())
+        {
+            Consumer_IsWaiting.store(false);
+            continue;
+        }
+        Consumer_Condition.wait_for(Lock, chrono::milliseconds(10));
+        Consumer_IsWaiting.store(false);
+    }
+}
+
+//---------------------------------------------------------------------------
+void MediaInfo_Events_Ring::Consumer_Wake ()
+{
+    if (!Consumer_IsWaiting.load())
+        return;
+    lock_guard<mutex> Lock(Consumer_Mutex);
+    Consumer_Condition.notify_one();
+}
+
+//---------------------------------------------------------------------------
+void MediaInfo_Events_Ring::Producer_Wake ()
+{
+    if (!Producer_IsWaiting.load())
+        return;
+    lock_guard<mutex> Lock(Producer_Mutex);
+    Producer_Condition.notify_one();
+}
+
+} //NameSpace
+
+#endif //MEDIAINFO_EVENTS_ASYNC
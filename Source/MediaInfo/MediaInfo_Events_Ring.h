@@ -0,0 +1,107 @@
+/*  Copyright (c) MediaArea.net SARL. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license that can
+ *  be found in the License.html file in the root of the source tree.
+ */
+
+//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//
+// Asynchronous delivery of events to the user callback
+//
+//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//---------------------------------------------------------------------------
+#ifndef MediaInfo_Events_RingH
+#define MediaInfo_Events_RingH
+//---------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------
+#include "MediaInfo/Setup.h"
+//---------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------
+#if MEDIAINFO_EVENTS_ASYNC
+//---------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------
+#include "MediaInfo/MediaInfo_Events.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+using namespace ZenLib;
+//---------------------------------------------------------------------------
+
+namespace MediaInfoLib
+{
+
+//***************************************************************************
+// Class MediaInfo_Events_Ring
+//***************************************************************************
+
+class MediaInfo_Events_Ring
+{
+public :
+    //Overflow
+    enum policy
+    {
+        Policy_Block,                       //Parsing waits for a free slot
+        Policy_DropOldest,                  //Oldest pending event is discarded
+        Policy_DropNewest,                  //New event is discarded
+    };
+
+    //Constructor/Destructor
+    MediaInfo_Events_Ring(MediaInfo_Event_CallBackFunction* CallBackFunction, void* UserHandler, policy Policy, size_t Size);
+    ~MediaInfo_Events_Ring(); //Pending events are delivered
+
+    //Producer side, parsing thread only
+    bool   Push (const int8u* Data_Content, size_t Data_Size); //False if the event can not be copied, it must be sent synchronously
+    void   Flush (); //Waits until all pushed events are delivered or dropped, must not be called with a lock the callback may need
+
+    //Stats
+    int64u Dropped_Get () {return Dropped.load();}
+
+private :
+    //Ring, one producer, consumer thread plus the producer when dropping the oldest event
+    struct slot
+    {
+        std::atomic<size_t>                 Sequence;
+        int8u*                              Data_Content; //Copy of the event and of the content it points to
+        size_t                              Data_Size;
+    };
+    slot*                                   Slots;
+    size_t                                  Mask;
+    size_t                                  Enqueue_Pos; //Producer only
+    std::atomic<size_t>                     Dequeue_Pos;
+    bool   Enqueue (int8u* Data_Content, size_t Data_Size);
+    bool   Dequeue (int8u* &Data_Content, size_t &Data_Size);
+
+    //Delivery
+    MediaInfo_Event_CallBackFunction*       CallBackFunction;
+    void*                                   UserHandler;
+    policy                                  Policy;
+    size_t                                  Pushed; //Producer only
+    std::atomic<size_t>                     Done; //Delivered or dropped
+    std::atomic<int64u>                     Dropped;
+
+    //Consumer
+    std::thread                             Consumer;
+    std::mutex                              Consumer_Mutex;
+    std::condition_variable                 Consumer_Condition;
+    std::atomic<bool>                       Consumer_IsWaiting;
+    std::atomic<bool>                       Consumer_Terminate;
+    void   Consume ();
+    void   Consumer_Wake ();
+
+    //Producer waiting for a free slot or for the delivery of all events
+    std::mutex                              Producer_Mutex;
+    std::condition_variable                 Producer_Condition;
+    std::atomic<bool>                       Producer_IsWaiting;
+    void   Producer_Wake ();
+};
+
+} //NameSpace
+
+#endif //MEDIAINFO_EVENTS_ASYNC
+
+#endif
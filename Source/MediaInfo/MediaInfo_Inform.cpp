@@ -158,6 +158,23 @@ Ztring MediaInfo_Internal::Inform()
     #if MEDIAINFO_TRACE
         if (MediaInfoLib::Config.Inform_Get()!=__T("MAXML") && (MediaInfoLib::Config.Trace_Level_Get() || MediaInfoLib::Config.Inform_Get()==__T("Details")))
         {
+            #if MEDIAINFO_EVENTS
+                if (Config.Inform_CallBackFunction_IsSet())
+                {
+                    //Most of the content was already sent during parsing, sending the remaining part without conversion to Ztring
+                    CriticalSectionLocker CSL(CS);
+                    if (!Details.empty())
+                        Config.Inform_Send(Details.data(), Details.size());
+                    else if (Info)
+                    {
+                        Info->Details_Flush();
+                        Inform_Sink Sink(Config);
+                        std::ostream Out(&Sink);
+                        Info->Details_Print(Out);
+                    }
+                    return Ztring();
+                }
+            #endif //MEDIAINFO_EVENTS
             if (!Details.empty())
                 return Ztring().From_UTF8(Details);
             else if (Info)
@@ -201,6 +218,33 @@ Ztring MediaInfo_Internal::Inform()
             Result+="</media>";
             return Ztring().From_UTF8(Result);
         }
+        if (MediaInfoLib::Config.Inform_Get().MakeLowerCase()==__T("profile"))
+        {
+            string Result="<profile";
+            Ztring Options=Get(Stream_General, 0, General_CompleteName, Info_Options);
+            if (InfoOption_ShowInInform<Options.size() && Options[InfoOption_ShowInInform]==__T('Y'))
+            {
+                Result+=" ref=\"";
+                Result+=XML_Encode(Get(Stream_General, 0, General_CompleteName)).To_UTF8();
+                Result+='\"';
+            }
+            Result+=">\n";
+            std::map<std::string, MediaInfo_Config_MediaInfo::parser_profile> Profiles=Config.Profile_Get();
+            for (const auto& Profile : Profiles)
+            {
+                Result+="  <parser name=\""+XML_Encode(Profile.first)+'\"';
+                Result+=" instances=\""+std::to_string(Profile.second.Instances)+'\"';
+                Result+=" calls=\""+std::to_string(Profile.second.Calls)+'\"';
+                Result+=" time_wall=\""+std::to_string(Profile.second.Time_Wall)+'\"';
+                Result+=" time_cpu=\""+std::to_string(Profile.second.Time_CPU)+'\"';
+                Result+=" bytes=\""+std::to_string(Profile.second.Bytes)+'\"';
+                Result+=" seeks=\""+std::to_string(Profile.second.Seeks)+'\"';
+                Result+=" buffer_reallocations=\""+std::to_string(Profile.second.Buffer_Reallocations)+'\"';
+                Result+=" subparsers=\""+std::to_string(Profile.second.SubParsers)+"\"/>\n";
+            }
+            Result+="</profile>";
+            return Ztring().From_UTF8(Result);
+        }
     #endif //MEDIAINFO_ADVANCED
 
     #if defined(MEDIAINFO_EBUCORE_YES)
@@ -326,6 +370,47 @@ Ztring MediaInfo_Internal::Inform()
             return __T("reVTMD is disabled due to its non-free licensing."); //return Export_reVTMD().Transform(*this);
     #endif //defined(MEDIAINFO_REVTMD_YES)
 
+    #if MEDIAINFO_EVENTS
+        //With an Inform callback, content is sent by chunks as soon as it is available, then released
+        enum inform_stream
+        {
+            Inform_Stream_Custom,           //Custom template, escape sequences are converted
+            Inform_Stream_Default,          //Default output, backslashes are kept
+            Inform_Stream_Converted,        //Already converted
+        };
+        bool Inform_Stream=Config.Inform_CallBackFunction_IsSet();
+        auto Inform_Stream_Send=[this](Ztring& Chunk, inform_stream Kind)
+        {
+            if (Chunk.empty())
+                return;
+            if (Kind==Inform_Stream_Default)
+                Chunk.FindAndReplace(__T("\\"), __T("|SC1|"), 0, Ztring_Recursive);
+            if (Kind!=Inform_Stream_Converted)
+            {
+                ConvertRetour(Chunk);
+                ConvertRetourSCX(Chunk);
+            }
+            string Chunk_UTF8=Chunk.To_UTF8();
+            Chunk.clear();
+            Config.Inform_Send(Chunk_UTF8.data(), Chunk_UTF8.size());
+        };
+        auto Inform_Stream_Split=[](Ztring& Before, std::vector<Ztring>& Parts, const string& Skeleton, const std::vector<size_t>& Offsets)
+        {
+            //XML or JSON skeleton is split at the track positions, each part is sent after the track with the same index
+            size_t Begin=0;
+            for (size_t Pos=0; Pos<=Offsets.size(); Pos++)
+            {
+                size_t End=Pos<Offsets.size()?Offsets[Pos]:Skeleton.size();
+                Ztring Part; Part.From_UTF8(Skeleton.substr(Begin, End-Begin));
+                if (Pos)
+                    Parts.push_back(Part);
+                else
+                    Before+=Part;
+                Begin=End;
+            }
+        };
+    #endif //MEDIAINFO_EVENTS
+
     #if defined(MEDIAINFO_CUSTOM_YES)
 
     if (!(
@@ -342,12 +427,20 @@ Ztring MediaInfo_Internal::Inform()
         Retour+=MediaInfoLib::Config.Inform_Get(__T("File_Begin"));
         Retour+=MediaInfoLib::Config.Inform_Get(__T("General_Begin"));
         Retour+=Inform(Stream_General, 0, false);
+        #if MEDIAINFO_EVENTS
+            if (Inform_Stream)
+                Inform_Stream_Send(Retour, Inform_Stream_Custom);
+        #endif //MEDIAINFO_EVENTS
         Retour+=MediaInfoLib::Config.Inform_Get(__T("General_End"));
         if (Count_Get(Stream_Video))
             Retour+=MediaInfoLib::Config.Inform_Get(__T("Video_Begin"));
         for (size_t I1=0; I1<Count_Get(Stream_Video); I1++)
         {
             Retour+=Inform(Stream_Video, I1, false);
+            #if MEDIAINFO_EVENTS
+                if (Inform_Stream)
+                    Inform_Stream_Send(Retour, Inform_Stream_Custom);
+            #endif //MEDIAINFO_EVENTS
             if (I1!=Count_Get(Stream_Video)-1)
                 Retour+=MediaInfoLib::Config.Inform_Get(__T("Video_Middle"));
         }
@@ -358,6 +451,10 @@ Ztring MediaInfo_Internal::Inform()
         for (size_t I1=0; I1<Count_Get(Stream_Audio); I1++)
         {
             Retour+=Inform(Stream_Audio, I1, false);
+            #if MEDIAINFO_EVENTS
+                if (Inform_Stream)
+                    Inform_Stream_Send(Retour, Inform_Stream_Custom);
+            #endif //MEDIAINFO_EVENTS
             if (I1!=Count_Get(Stream_Audio)-1)
                 Retour+=MediaInfoLib::Config.Inform_Get(__T("Audio_Middle"));
         }
@@ -368,6 +465,10 @@ Ztring MediaInfo_Internal::Inform()
         for (size_t I1=0; I1<Count_Get(Stream_Text); I1++)
         {
             Retour+=Inform(Stream_Text, I1, false);
+            #if MEDIAINFO_EVENTS
+                if (Inform_Stream)
+                    Inform_Stream_Send(Retour, Inform_Stream_Custom);
+            #endif //MEDIAINFO_EVENTS
             if (I1!=Count_Get(Stream_Text)-1)
                 Retour+=MediaInfoLib::Config.Inform_Get(__T("Text_Middle"));
         }
@@ -378,6 +479,10 @@ Ztring MediaInfo_Internal::Inform()
         for (size_t I1=0; I1<Count_Get(Stream_Other); I1++)
         {
             Retour+=Inform(Stream_Other, I1, false);
+            #if MEDIAINFO_EVENTS
+                if (Inform_Stream)
+                    Inform_Stream_Send(Retour, Inform_Stream_Custom);
+            #endif //MEDIAINFO_EVENTS
             if (I1!=Count_Get(Stream_Other)-1)
                 Retour+=MediaInfoLib::Config.Inform_Get(__T("Other_Middle"));
         }
@@ -388,6 +493,10 @@ Ztring MediaInfo_Internal::Inform()
         for (size_t I1=0; I1<Count_Get(Stream_Image); I1++)
         {
             Retour+=Inform(Stream_Image, I1, false);
+            #if MEDIAINFO_EVENTS
+                if (Inform_Stream)
+                    Inform_Stream_Send(Retour, Inform_Stream_Custom);
+            #endif //MEDIAINFO_EVENTS
             if (I1!=Count_Get(Stream_Image)-1)
                 Retour+=MediaInfoLib::Config.Inform_Get(__T("Image_Middle"));
         }
@@ -398,6 +507,10 @@ Ztring MediaInfo_Internal::Inform()
         for (size_t I1=0; I1<Count_Get(Stream_Menu); I1++)
         {
             Retour+=Inform(Stream_Menu, I1, false);
+            #if MEDIAINFO_EVENTS
+                if (Inform_Stream)
+                    Inform_Stream_Send(Retour, Inform_Stream_Custom);
+            #endif //MEDIAINFO_EVENTS
             if (I1!=Count_Get(Stream_Menu)-1)
                 Retour+=MediaInfoLib::Config.Inform_Get(__T("Menu_Middle"));
         }
@@ -405,6 +518,14 @@ Ztring MediaInfo_Internal::Inform()
             Retour+=MediaInfoLib::Config.Inform_Get(__T("Menu_End"));
         Retour+=MediaInfoLib::Config.Inform_Get(__T("File_End"));
 
+        #if MEDIAINFO_EVENTS
+            if (Inform_Stream)
+            {
+                Inform_Stream_Send(Retour, Inform_Stream_Custom);
+                return Retour;
+            }
+        #endif //MEDIAINFO_EVENTS
+
         ConvertRetour(Retour);
 
         //Special characters
@@ -429,6 +550,11 @@ Ztring MediaInfo_Internal::Inform()
     bool JSON=false;
     bool Conformance_JSON=false;
     bool CSV=false;
+    #if MEDIAINFO_EVENTS
+        std::vector<std::pair<stream_t, size_t> > Inform_Stream_Tracks; //XML and JSON tracks, created when sent
+        std::vector<size_t> Inform_Stream_Offsets; //Position of each track in the XML or JSON skeleton
+        std::vector<Ztring> Inform_Stream_Parts; //Skeleton after each track, Retour is the part before the first track
+    #endif //MEDIAINFO_EVENTS
     #if defined(MEDIAINFO_HTML_YES)
     if (MediaInfoLib::Config.Inform_Get()==__T("HTML"))
         HTML=true;
@@ -557,6 +683,14 @@ Ztring MediaInfo_Internal::Inform()
                     if (!B.empty()) Node_Current->Add_Attribute("typeorder", B);
                 }
                 Node* Track=new Node();
+                #if MEDIAINFO_EVENTS
+                if (Inform_Stream && !Conformance_JSON)
+                {
+                    Track->RawContent_IsDeferred=true; //Track content is created when sent
+                    Inform_Stream_Tracks.push_back(std::make_pair((stream_t)StreamKind, StreamPos));
+                }
+                else
+                #endif //MEDIAINFO_EVENTS
                 Track->RawContent=Inform((stream_t)StreamKind, StreamPos, false).To_UTF8();
                 Node_Current->Childs.push_back(Track);
             }
@@ -569,6 +703,10 @@ Ztring MediaInfo_Internal::Inform()
 
             if (HTML) Retour += __T("    </table>");
             if (!XML && !XML_0_7_78_MA && !XML_0_7_78_MI && !JSON) Retour+=MediaInfoLib::Config.LineSeparator_Get();
+            #if MEDIAINFO_EVENTS
+                if (Inform_Stream && !XML && !XML_0_7_78_MA && !XML_0_7_78_MI && !JSON)
+                    Inform_Stream_Send(Retour, Inform_Stream_Default);
+            #endif //MEDIAINFO_EVENTS
         }
     }
 
@@ -630,6 +768,14 @@ Ztring MediaInfo_Internal::Inform()
     #if defined(MEDIAINFO_XML_YES)
         if (XML || XML_0_7_78_MA || XML_0_7_78_MI)
         {
+            #if MEDIAINFO_EVENTS
+            if (Inform_Stream)
+            {
+                Retour.clear();
+                Inform_Stream_Split(Retour, Inform_Stream_Parts, To_XML(*Node_Main, 0, false, false, &Inform_Stream_Offsets), Inform_Stream_Offsets);
+            }
+            else
+            #endif //MEDIAINFO_EVENTS
             Retour=Ztring().From_UTF8(To_XML(*Node_Main, 0, false, false));
             delete Node_Main;
         }
@@ -649,10 +795,20 @@ Ztring MediaInfo_Internal::Inform()
             if (!Conformance_JSON)
                 Retour+=__T('\n');
 
+            #if MEDIAINFO_EVENTS
+            if (Inform_Stream && !Conformance_JSON)
+                Inform_Stream_Split(Retour, Inform_Stream_Parts, To_JSON(*Node_Main, 0, false, false, false, &Inform_Stream_Offsets), Inform_Stream_Offsets);
+            else
+            #endif //MEDIAINFO_EVENTS
             Retour+=Ztring().From_UTF8(To_JSON(*Node_Main, 0, false, false, false));
+            #if MEDIAINFO_EVENTS
+            Ztring& Retour_End=Inform_Stream_Parts.empty()?Retour:Inform_Stream_Parts.back();
+            #else //MEDIAINFO_EVENTS
+            Ztring& Retour_End=Retour;
+            #endif //MEDIAINFO_EVENTS
             if (!Conformance_JSON)
-                Retour+=__T('\n');
-            Retour+=__T('}');
+                Retour_End+=__T('\n');
+            Retour_End+=__T('}');
             delete Node_Main;
         }
     #endif //MEDIAINFO_JSON_YES
@@ -663,18 +819,32 @@ Ztring MediaInfo_Internal::Inform()
     //Special characters
     ConvertRetourSCX(Retour);
 
+    #if MEDIAINFO_EVENTS
+        for (size_t Pos=0; Pos<Inform_Stream_Parts.size(); Pos++)
+        {
+            Inform_Stream_Parts[Pos].FindAndReplace(__T("\\"), __T("|SC1|"), 0, Ztring_Recursive);
+            ConvertRetour(Inform_Stream_Parts[Pos]);
+            ConvertRetourSCX(Inform_Stream_Parts[Pos]);
+        }
+    #endif //MEDIAINFO_EVENTS
+
     #if MEDIAINFO_TRACE
         if (XML_0_7_78_MA)
         {
             if (MediaInfoLib::Config.Trace_Level_Get() || MediaInfoLib::Config.Inform_Get()==__T("Details"))
             {
-                Retour+=__T("<MediaTrace xmlns=\"http")+(MediaInfoLib::Config.Https_Get()?Ztring(__T("s")):Ztring())+__T("://mediaarea.net/mediatrace\" version=\"0.1\">\n");
+                #if MEDIAINFO_EVENTS
+                Ztring& Retour_End=Inform_Stream_Parts.empty()?Retour:Inform_Stream_Parts.back();
+                #else //MEDIAINFO_EVENTS
+                Ztring& Retour_End=Retour;
+                #endif //MEDIAINFO_EVENTS
+                Retour_End+=__T("<MediaTrace xmlns=\"http")+(MediaInfoLib::Config.Https_Get()?Ztring(__T("s")):Ztring())+__T("://mediaarea.net/mediatrace\" version=\"0.1\">\n");
                 if (!Details.empty())
-                    Retour+=Ztring().From_UTF8(Details);
+                    Retour_End+=Ztring().From_UTF8(Details);
                 else if (Info)
-                    Retour+=Info->Details_Get();
-                Retour+=__T("\n");
-                Retour+=__T("</MediaTrace>\n");
+                    Retour_End+=Info->Details_Get();
+                Retour_End+=__T("\n");
+                Retour_End+=__T("</MediaTrace>\n");
             }
         }
     #endif //MEDIAINFO_TRACE
@@ -684,6 +854,25 @@ Ztring MediaInfo_Internal::Inform()
         Retour.From_UTF8("https://mediaarea.net/MoreInfo?mi="+URL_Encoded_Encode(Retour.To_UTF8()));
     #endif //defined(MEDIAINFO_JSON_YES)
 
+    #if MEDIAINFO_EVENTS
+        if (Inform_Stream)
+        {
+            //XML and JSON tracks are created when their place in the output is reached
+            Inform_Stream_Send(Retour, Inform_Stream_Converted);
+            for (size_t Pos=0; Pos<Inform_Stream_Parts.size(); Pos++)
+            {
+                if (Pos<Inform_Stream_Tracks.size())
+                {
+                    Ztring Track=Inform(Inform_Stream_Tracks[Pos].first, Inform_Stream_Tracks[Pos].second, false);
+                    Inform_Stream_Send(Track, Inform_Stream_Default);
+                }
+                Inform_Stream_Send(Inform_Stream_Parts[Pos], Inform_Stream_Converted);
+            }
+            Retour.clear();
+            return Retour;
+        }
+    #endif //MEDIAINFO_EVENTS
+
     return Retour;
 
     #else //defined(MEDIAINFO_TEXT_YES) || defined(MEDIAINFO_HTML_YES) || defined(MEDIAINFO_XML_YES) || defined(MEDIAINFO_CSV_YES)
@@ -1138,7 +1327,7 @@ Ztring MediaInfo_Internal::Inform (stream_t StreamKind, size_t StreamPos, bool I
         Elements(0)=Elements(0).SubString(__T("%"), __T("%"));
 
         //Test if there is something to replace
-        size_t Pos=MediaInfoLib::Config.Info_Get(StreamKind).Find(Elements(0));
+        size_t Pos=MediaInfoLib::Config.Info_Find(StreamKind, Elements(0));
         if (Pos!=std::string::npos)
         {
             if (Get(StreamKind, StreamPos, Pos).size()>0)
@@ -21,6 +21,12 @@
 #include "MediaInfo/MediaInfo_Config.h"
 #include "MediaInfo/File__Analyze.h"
 #include "MediaInfo/File__MultipleParsing.h"
+#if MEDIAINFO_BINARY
+    #include "MediaInfo/MediaInfo_Binary.h"
+#endif //MEDIAINFO_BINARY
+#if MEDIAINFO_CACHE
+    #include "MediaInfo/MediaInfo_Cache.h"
+#endif //MEDIAINFO_CACHE
 #if defined(MEDIAINFO_FILE_YES)
 #include "ZenLib/File.h"
 #endif //defined(MEDIAINFO_DIRECTORY_YES)
@@ -1079,6 +1085,9 @@ MediaInfo_Internal::MediaInfo_Internal()
         Reader=NULL;
     #endif //!defined(MEDIAINFO_READER_NO)
     Info_IsMultipleParsing=false;
+    #if MEDIAINFO_CACHE
+        Cache_IsFromList=false;
+    #endif //MEDIAINFO_CACHE
 
     Stream.resize(Stream_Max);
     Stream_More.resize(Stream_Max);
@@ -1159,6 +1168,17 @@ size_t MediaInfo_Internal::Open(const String &File_Name_)
     Config.IsFinishing=false;
     }
 
+    //Cache, referenced files and MediaInfoList files only
+    #if MEDIAINFO_CACHE
+        string Cache_Key;
+        if (BlockMethod!=1 && (Config.File_IsReferenced_Get() || Cache_IsFromList) && Config.File_Names.size()==1 && Config.File_IgnoreEditsBefore==0 && Config.File_IgnoreEditsAfter==(int64u)-1 && !MediaInfoLib::Config.Trace_Level_Get() && Cache.IsEnabled()) //Edits are set directly by the calling parser, not in the key
+        {
+            Cache_Key=MediaInfo_Cache::Key_Get(Config.File_Names[0], Cache_Options);
+            if (!Cache_Key.empty() && Cache_Load(Cache_Key))
+                return Count_Get(Stream_General);
+        }
+    #endif //MEDIAINFO_CACHE
+
     //Parsing
     if (BlockMethod==1)
     {
@@ -1172,10 +1192,79 @@ size_t MediaInfo_Internal::Open(const String &File_Name_)
     else
     {
         Entry(); //Normal parsing
+        #if MEDIAINFO_CACHE
+            if (!Cache_Key.empty())
+                Cache_Save(Cache_Key);
+        #endif //MEDIAINFO_CACHE
         return Count_Get(Stream_General);
     }
 }
 
+//---------------------------------------------------------------------------
+#if MEDIAINFO_CACHE
+bool MediaInfo_Internal::Cache_Load(const string &Key)
+{
+    MediaInfo_Cache::item Item;
+    if (!Cache.Get(Key, Item))
+        return false;
+
+    CriticalSectionLocker CSL(CS);
+    Stream_Restore(Item.Stream, Item.Stream_More, Item.File_Size);
+    return true;
+}
+
+//---------------------------------------------------------------------------
+void MediaInfo_Internal::Cache_Save(const string &Key)
+{
+    CriticalSectionLocker CSL(CS);
+    if (Config.RequestTerminate || Stream[Stream_General].empty())
+        return;
+
+    MediaInfo_Cache::item Item;
+    Item.Stream=Stream;
+    Item.Stream_More=Stream_More;
+    Item.File_Size=Config.File_Size;
+    Cache.Set(Key, Item);
+}
+#endif //MEDIAINFO_CACHE
+
+//---------------------------------------------------------------------------
+#if MEDIAINFO_BINARY
+bool MediaInfo_Internal::Binary_Load(const int8u* Buffer, size_t Buffer_Size)
+{
+    std::vector<std::vector<ZtringList> > Stream_New;
+    std::vector<std::vector<ZtringListList> > Stream_More_New;
+    int64u File_Size;
+    if (MediaInfo_Binary::Deserialize(Buffer, Buffer_Size, Stream_New, Stream_More_New, File_Size)!=Buffer_Size)
+        return false;
+
+    CriticalSectionLocker CSL(CS);
+    Stream_Restore(Stream_New, Stream_More_New, File_Size);
+    return true;
+}
+
+//---------------------------------------------------------------------------
+void MediaInfo_Internal::Stream_Restore(std::vector<std::vector<ZtringList> > &Stream_New, std::vector<std::vector<ZtringListList> > &Stream_More_New, int64u File_Size)
+{
+    Stream.swap(Stream_New);
+    Stream_More.swap(Stream_More_New);
+    Config.File_Size=File_Size;
+    if (Config.File_KeepInfo_Get())
+    {
+        //Results only, for the calling parser
+        Info=new File__Analyze;
+        #if MEDIAINFO_TRACE
+            Info->Init(&Config, &Details, &Stream, &Stream_More);
+        #else //MEDIAINFO_TRACE
+            Info->Init(&Config, &Stream, &Stream_More);
+        #endif //MEDIAINFO_TRACE
+        if (!Config.File_Names.empty())
+            Info->File_Name=Config.File_Names[0];
+    }
+    Config.State_Set(1);
+}
+#endif //MEDIAINFO_BINARY
+
 //---------------------------------------------------------------------------
 void MediaInfo_Internal::Entry()
 {
@@ -1507,6 +1596,12 @@ void MediaInfo_Internal::Entry()
 //---------------------------------------------------------------------------
 size_t MediaInfo_Internal::Open (const int8u* Begin, size_t Begin_Size, const int8u* End, size_t End_Size, int64u File_Size)
 {
+    #if MEDIAINFO_BINARY
+        //Results from File_Binary_StringPointer, restored without parsing
+        if (!End && !Info && MediaInfo_Binary::IsBinary(Begin, Begin_Size) && Binary_Load(Begin, Begin_Size))
+            return 1;
+    #endif //MEDIAINFO_BINARY
+
     Open_Buffer_Init(File_Size);
     Open_Buffer_Continue(Begin, Begin_Size);
     if (End && Begin_Size+End_Size<=File_Size)
@@ -1536,6 +1631,9 @@ size_t MediaInfo_Internal::Open_Buffer_Init (int64u File_Size_, const String &Fi
 
     if (Info==NULL)
     {
+        #if MEDIAINFO_ADVANCED
+            Config.Profile_Clear();
+        #endif //MEDIAINFO_ADVANCED
         Ztring ForceParser = Config.File_ForceParser_Get();
         if (!ForceParser.empty())
         {
@@ -1731,6 +1829,12 @@ std::bitset<32> MediaInfo_Internal::Open_Buffer_Continue (const int8u* ToAdd, si
         Info_IsMultipleParsing=false;
     }
 
+    //Trace is sent to the Inform callback as soon as top level elements are complete
+    #if MEDIAINFO_TRACE && MEDIAINFO_EVENTS
+        if (!Info_IsMultipleParsing)
+            Info->Details_Flush();
+    #endif //MEDIAINFO_TRACE && MEDIAINFO_EVENTS
+
     #if 0 //temp, for old users
     //The parser wanted seek but the buffer is not seekable
     if (Info->File_GoTo!=(int64u)-1 && Config.File_IsSeekable_Get()==0)
@@ -1750,6 +1854,16 @@ std::bitset<32> MediaInfo_Internal::Open_Buffer_Continue (const int8u* ToAdd, si
         Info->File_GoTo=(int64u)-1;
     }
 
+    //Sampled blocks not read by the parser
+    #if MEDIAINFO_FINGERPRINT
+        if (!Info_IsMultipleParsing && Info->Fingerprint_Continue())
+        {
+            std::bitset<32> Status=Info->Status;
+            Status[File__Analyze::IsFinished]=false; //Reading must continue
+            return Status;
+        }
+    #endif //MEDIAINFO_FINGERPRINT
+
     return Info->Status;
     #endif
 }
@@ -1805,6 +1919,7 @@ size_t MediaInfo_Internal::Open_Buffer_Seek (size_t Method, int64u Value, int64u
 //---------------------------------------------------------------------------
 size_t MediaInfo_Internal::Open_Buffer_Finalize ()
 {
+    {
     CriticalSectionLocker CSL(CS);
     MEDIAINFO_DEBUG_CONFIG_TEXT(Debug+=__T("Open_Buffer_Finalize");)
     if (Info==NULL)
@@ -1815,6 +1930,9 @@ size_t MediaInfo_Internal::Open_Buffer_Finalize ()
         if (Config.Demux_EventWasSent)
             return 0;
     #endif //MEDIAINFO_DEMUX
+    #if MEDIAINFO_ADVANCED
+        Info->Profile_Flush();
+    #endif //MEDIAINFO_ADVANCED
 
     //Cleanup
     if (!Config.File_IsSub_Get() && !Config.File_KeepInfo_Get()) //We need info for the calling parser
@@ -1835,6 +1953,38 @@ size_t MediaInfo_Internal::Open_Buffer_Finalize ()
         }
     #endif //MEDIAINFO_EVENTS
 
+    //Profile
+    #if MEDIAINFO_ADVANCED && MEDIAINFO_EVENTS
+        if (Config.File_Profile_Get())
+        {
+            std::map<std::string, MediaInfo_Config_MediaInfo::parser_profile> Profiles=Config.Profile_Get();
+            for (std::map<std::string, MediaInfo_Config_MediaInfo::parser_profile>::iterator Profile=Profiles.begin(); Profile!=Profiles.end(); ++Profile)
+            {
+                struct MediaInfo_Event_General_Profile_0 Event;
+                memset(&Event, 0xFF, sizeof(struct MediaInfo_Event_Generic));
+                Event.EventCode=MediaInfo_EventCode_Create(MediaInfo_Parser_None, MediaInfo_Event_General_Profile, 0);
+                Event.EventSize=sizeof(struct MediaInfo_Event_General_Profile_0);
+                Event.StreamIDs_Size=0;
+                Event.ParserName=Profile->first.c_str();
+                Event.Instances=Profile->second.Instances;
+                Event.Calls=Profile->second.Calls;
+                Event.Time_Wall=Profile->second.Time_Wall;
+                Event.Time_CPU=Profile->second.Time_CPU;
+                Event.Bytes=Profile->second.Bytes;
+                Event.Seeks=Profile->second.Seeks;
+                Event.Buffer_Reallocations=Profile->second.Buffer_Reallocations;
+                Event.SubParsers=Profile->second.SubParsers;
+                Config.Event_Send(NULL, (const int8u*)&Event, sizeof(MediaInfo_Event_General_Profile_0));
+            }
+        }
+    #endif //MEDIAINFO_ADVANCED && MEDIAINFO_EVENTS
+    }
+
+    //Events still in the asynchronous delivery ring, not under CS because the callback may use this instance
+    #if MEDIAINFO_EVENTS_ASYNC
+        Config.Event_Async_Flush();
+    #endif //MEDIAINFO_EVENTS_ASYNC
+
     EXECUTE_SIZE_T(1, Debug+=__T("Open_Buffer_Finalize, will return 1"))
 }
 
@@ -1887,6 +2037,11 @@ void MediaInfo_Internal::Close()
             Yield();
     }
 
+    //Events still in the asynchronous delivery ring, not under CS because the callback may use this instance
+    #if MEDIAINFO_EVENTS_ASYNC
+        Config.Event_Async_Flush();
+    #endif //MEDIAINFO_EVENTS_ASYNC
+
     CriticalSectionLocker CSL(CS);
     MEDIAINFO_DEBUG_CONFIG_TEXT(Debug+=__T("Close");)
     Stream.clear();
@@ -2219,14 +2374,14 @@ Ztring MediaInfo_Internal::Get(stream_t StreamKind, size_t StreamPos, const Stri
         CS.Leave();
         const Ztring InformZtring=Inform(StreamKind, StreamPos, true);
         CS.Enter();
-        size_t Pos=MediaInfoLib::Config.Info_Get(StreamKind).Find(__T("Inform"));
+        size_t Pos=MediaInfoLib::Config.Info_Find(StreamKind, __T("Inform"));
         if (Pos!=Error)
             Stream[StreamKind][StreamPos](Pos)=InformZtring;
     }
 #endif
 
     //Case of specific info
-    size_t ParameterI=MediaInfoLib::Config.Info_Get(StreamKind).Find(Parameter, KindOfSearch);
+    size_t ParameterI=KindOfSearch==Info_Name?MediaInfoLib::Config.Info_Find(StreamKind, Parameter):MediaInfoLib::Config.Info_Get(StreamKind).Find(Parameter, KindOfSearch);
     if (ParameterI==Error)
     {
         ParameterI=Stream_More[StreamKind][StreamPos].Find(Parameter, KindOfSearch);
@@ -2262,6 +2417,23 @@ Ztring MediaInfo_Internal::Get(stream_t StreamKind, size_t StreamPos, const Stri
     EXECUTE_STRING(Get(StreamKind, StreamPos, ParameterI, KindOfInfo), Debug+=__T("Get, will return ");Debug+=ToReturn;)
 }
 
+//---------------------------------------------------------------------------
+size_t MediaInfo_Internal::Get(size_t Count, const stream_t* StreamKinds, const size_t* StreamPoss, const String* Parameters, String* Results, info_t KindOfInfo)
+{
+    if (!Count || !StreamKinds || !StreamPoss || !Parameters || !Results)
+        return 0;
+
+    //Each request takes the lock on its own (the lock is not recursive on all platforms), the batch is not atomic
+    size_t Count_NotEmpty=0;
+    for (size_t Pos=0; Pos<Count; Pos++)
+    {
+        Results[Pos]=Get(StreamKinds[Pos], StreamPoss[Pos], Parameters[Pos], KindOfInfo);
+        if (!Results[Pos].empty())
+            Count_NotEmpty++;
+    }
+    return Count_NotEmpty;
+}
+
 //***************************************************************************
 // Set File info
 //***************************************************************************
@@ -2320,6 +2492,10 @@ String MediaInfo_Internal::Option (const String &Option, const String &Value)
     CriticalSectionLocker CSL(CS);
     MEDIAINFO_DEBUG_CONFIG_TEXT(Debug+=__T("Option, Option=");Debug+=Ztring(Option);Debug+=__T(", Value=");Debug+=Ztring(Value);)
     Ztring OptionLower=Option; OptionLower.MakeLowerCase();
+    #if MEDIAINFO_CACHE
+        if (!Option.empty())
+            Cache_Options(Option)=Value;
+    #endif //MEDIAINFO_CACHE
     if (Option.empty())
         return String();
     else if (OptionLower==__T("language_update"))
@@ -2343,6 +2519,10 @@ String MediaInfo_Internal::Option (const String &Option, const String &Value)
         BlockMethod=1;
         return __T("");
     }
+    else if (OptionLower==__T("profile"))
+    {
+        return Config.Option(__T("File_Profile"), Value);
+    }
     else if (Option==__T("info_capacities"))
     {
         return __T("Option removed");
@@ -2477,6 +2657,16 @@ String MediaInfo_Internal::Option (const String &Option, const String &Value)
             return Ztring::ToZtring((int64u)Inform_Cache.data()) + __T(':') + Ztring::ToZtring((int64u)Inform_Cache.size());
         }
     #endif //MEDIAINFO_ADVANCED
+    #if MEDIAINFO_BINARY
+        if (OptionLower.find(__T("file_binary_stringpointer")) == 0)
+        {
+            if (Info && Info->Status[File__Analyze::IsUpdated])
+                Info->Open_Buffer_Update();
+            Binary_Content.clear();
+            MediaInfo_Binary::Serialize(Binary_Content, Stream, Stream_More, Config.File_Size);
+            return Ztring::ToZtring((int64u)Binary_Content.data()) + __T(':') + Ztring::ToZtring((int64u)Binary_Content.size());
+        }
+    #endif //MEDIAINFO_BINARY
     else if (OptionLower.find(__T("reset"))==0)
     {
         MediaInfoLib::Config.Init(true);
@@ -86,6 +86,7 @@ public :
     //Get
     Ztring Get (stream_t StreamKind, size_t StreamNumber, size_t Parameter, info_t InfoKind=Info_Text);
     Ztring Get (stream_t StreamKind, size_t StreamNumber, const String &Parameter, info_t InfoKind=Info_Text, info_t SearchKind=Info_Name);
+    size_t Get (size_t Count, const stream_t* StreamKinds, const size_t* StreamNumbers, const String* Parameters, String* Results, info_t InfoKind=Info_Text);
 
     //Set
     size_t Set (const String &ToSet, stream_t StreamKind, size_t StreamNumber, size_t Parameter, const String &OldValue=__T(""));
@@ -143,6 +144,21 @@ private :
     //Open Buffer
     bool Info_IsMultipleParsing;
 
+    //Binary
+    #if MEDIAINFO_BINARY
+    string Binary_Content; //Content returned by File_Binary_StringPointer
+    bool Binary_Load (const int8u* Buffer, size_t Buffer_Size);
+    void Stream_Restore (std::vector<std::vector<ZtringList> > &Stream_New, std::vector<std::vector<ZtringListList> > &Stream_More_New, int64u File_Size); //Results without parser, CS must be locked
+    #endif //MEDIAINFO_BINARY
+
+    //Cache
+    #if MEDIAINFO_CACHE
+    ZtringListList Cache_Options; //Options set on this instance, part of the cache key
+    bool Cache_IsFromList; //Set by MediaInfoList, referenced files use the cache in all cases
+    bool Cache_Load (const std::string &Key);
+    void Cache_Save (const std::string &Key);
+    #endif //MEDIAINFO_CACHE
+
     //Config
     std::vector<std::vector<ZtringList> > Stream;
     std::vector<std::vector<ZtringListList> > Stream_More;
@@ -314,6 +314,104 @@ const char* Mpegv_matrix_coefficients(int8u matrix_coefficients);
 const char* Mpegv_matrix_coefficients_ColorSpace(int8u matrix_coefficients);
 const char* Avs3V_matrix_coefficients(int8u matrix_coefficients);
 
+//***************************************************************************
+// Sample sizes
+//***************************************************************************
+
+//---------------------------------------------------------------------------
+static int8u sample_sizes_Width(int64u Value)
+{
+    if (Value<=0xFF)
+        return 1;
+    if (Value<=0xFFFF)
+        return 2;
+    if (Value<=0xFFFFFFFF)
+        return 4;
+    return 8;
+}
+
+//---------------------------------------------------------------------------
+void sample_sizes::push_back(int64u Value)
+{
+    if (!Width)
+    {
+        if (!Count)
+            First=Value;
+        if (Value==First)
+        {
+            Count++;
+            return;
+        }
+        Widen(sample_sizes_Width(Value));
+    }
+    else if (sample_sizes_Width(Value)>Width)
+        Widen(sample_sizes_Width(Value));
+
+    Data.resize(Data.size()+Width);
+    Set(Count, Value);
+    Count++;
+}
+
+//---------------------------------------------------------------------------
+void sample_sizes::resize(size_t NewCount, int64u Value)
+{
+    if (NewCount<=Count)
+    {
+        Count=NewCount;
+        if (Width)
+            Data.resize(Count*Width);
+        return;
+    }
+    if (Width && sample_sizes_Width(Value)>Width)
+        Widen(sample_sizes_Width(Value));
+    if (!Width && (!Count || Value==First))
+    {
+        if (!Count)
+            First=Value;
+        Count=NewCount;
+        return;
+    }
+    if (!Width)
+        Widen(sample_sizes_Width(Value));
+    Data.resize(NewCount*Width);
+    for (; Count<NewCount; Count++)
+        Set(Count, Value);
+}
+
+//---------------------------------------------------------------------------
+void sample_sizes::Widen(int8u NewWidth)
+{
+    if (!Width && Count)
+    {
+        int8u First_Width=sample_sizes_Width(First);
+        if (NewWidth<First_Width)
+            NewWidth=First_Width;
+    }
+    if (NewWidth<=Width)
+        return;
+
+    //In place, from back to front, so items not yet moved are not overwritten
+    int8u OldWidth=Width;
+    Width=NewWidth;
+    Data.resize(Count*Width);
+    for (size_t Pos=Count; Pos--;)
+        Set(Pos, Get(Pos, OldWidth));
+}
+
+//---------------------------------------------------------------------------
+void sample_sizes::Set(size_t Pos, int64u Value)
+{
+    int8u* Item=&Data[0]+Pos*Width;
+    switch (Width)
+    {
+        case 1 : *Item=(int8u)Value; break;
+        case 2 : int16u2LittleEndian((char*)Item, (int16u)Value); break;
+        case 4 : int32u2LittleEndian((char*)Item, (int32u)Value); break;
+        case 8 : int64u2LittleEndian((char*)Item, Value); break;
+        default: ;
+    }
+}
+
 //***************************************************************************
 // Constructor/Destructor
 //***************************************************************************
@@ -2365,7 +2463,7 @@ void File_Mpeg4::stream::SplitAudio(File_Mpeg4::stream& Video, int32u moov_mvhd_
         return;
 
     std::vector<stsc_struct> NewStsc;
-    std::vector<int64u> NewStsz;
+    sample_sizes NewStsz;
     std::vector<stts_struct> NewStts;
 
     for (;;)
@@ -2605,9 +2703,9 @@ bool File_Mpeg4::BookMark_Needed()
                 {
                     int64u* stco_Current = &Temp->second.stco[0];
                     int64u* stco_Max = stco_Current + Temp->second.stco.size();
-                    int64u* stsz_Current = Temp->second.stsz.empty()?NULL:&Temp->second.stsz[0];
+                    size_t stsz_Current = 0;
                     int32u* stsz_Current2 = Temp->second.stsz_FirstSubSampleSize.empty()?NULL:&Temp->second.stsz_FirstSubSampleSize[0];
-                    int64u* stsz_Max = stsz_Current + Temp->second.stsz.size();
+                    size_t stsz_Max = Temp->second.stsz.size();
                     int32u* stsz_Max2 = stsz_Current2 + Temp->second.stsz_FirstSubSampleSize.size();
                     stream::stsc_struct* stsc_Current = &Temp->second.stsc[0];
                     stream::stsc_struct* stsc_Max = stsc_Current + Temp->second.stsc.size();
@@ -2633,7 +2731,7 @@ bool File_Mpeg4::BookMark_Needed()
                             //Each sample has its own size
                             int64u Chunk_Offset = 0;
                             for (size_t Pos = 0; Pos < stsc_Current->SamplesPerChunk; Pos++)
-                                if (*stsz_Current)
+                                if (int64u stsz_Size = Temp->second.stsz[stsz_Current])
                                 {
                                     mdat_Pos_Type mdat_Pos_Temp2;
                                     mdat_Pos_Temp2.Offset = *stco_Current + Chunk_Offset;
@@ -2641,11 +2739,11 @@ bool File_Mpeg4::BookMark_Needed()
                                     if (stsz_Current2 && stsz_Current2 <= stsz_Max2 && *stsz_Current2)
                                         mdat_Pos_Temp2.Size = *stsz_Current2;
                                     else
-                                        mdat_Pos_Temp2.Size = *stsz_Current;
+                                        mdat_Pos_Temp2.Size = stsz_Size;
                                     mdat_Pos.push_back(mdat_Pos_Temp2);
                                     if (HandleAllContent)
                                         mdat_Pos_Caption.push_back(mdat_Pos_Temp2);
-                                    Chunk_Offset += *stsz_Current;
+                                    Chunk_Offset += stsz_Size;
                                     stsz_Current++;
                                     if (stsz_Current2)
                                         stsz_Current2++;
@@ -2933,6 +3031,16 @@ bool File_Mpeg4::BookMark_Needed()
     if (mdat_Pos.empty())
         return false;
 
+    #if MEDIAINFO_PREFETCH
+        //First block of each stream parsed in priority, requested all together
+        for (size_t i=0; i<mdat_Pos_ToParseInPriority_StreamIDs.size(); i++)
+        {
+            std::map<int32u, stream>::iterator Stream=Streams.find(mdat_Pos_ToParseInPriority_StreamIDs[i]);
+            if (Stream!=Streams.end() && !Stream->second.stco.empty())
+                Prefetch(Stream->second.FirstUsedOffset!=(int64u)-1?Stream->second.FirstUsedOffset:Stream->second.stco.front(), 256*1024);
+        }
+    #endif //MEDIAINFO_PREFETCH
+
     IsParsing_mdat=false;
     if (!mdat_Pos_ToParseInPriority_StreamIDs.empty())
     {
@@ -14,6 +14,7 @@
 #include "MediaInfo/File__HasReferences.h"
 #include "MediaInfo/MediaInfo_Internal.h"
 #include "MediaInfo/Multiple/File_Mpeg4_Descriptors.h"
+#include "ZenLib/Utils.h"
 #include <memory>
 class File_MpegPs;
 //---------------------------------------------------------------------------
@@ -27,6 +28,44 @@ struct stts_struct
     int32u                      SampleDuration;
 };
 
+//---------------------------------------------------------------------------
+// Sample sizes, each stored with the smallest byte width of the table
+// (nothing is stored per sample while all sizes are the same)
+class sample_sizes
+{
+public :
+    sample_sizes()                              : Count(0), Width(0), First(0) {}
+
+    void   push_back(int64u Value);
+    void   resize(size_t NewCount, int64u Value=0);
+    void   clear()                              {Count=0; Width=0; First=0; Data.clear();}
+    size_t size() const                         {return Count;}
+    bool   empty() const                        {return !Count;}
+    int64u operator[](size_t Pos) const         {return Get(Pos, Width);}
+
+private :
+    size_t                      Count;
+    int8u                       Width; //0 if all sizes are First
+    int64u                      First;
+    std::vector<int8u>          Data;
+
+    void   Widen(int8u NewWidth);
+    void   Set(size_t Pos, int64u Value);
+    int64u Get(size_t Pos, int8u ItemWidth) const
+    {
+        if (!ItemWidth)
+            return First;
+        const char* Item=(const char*)&Data[0]+Pos*ItemWidth;
+        switch (ItemWidth)
+        {
+            case 1 : return (int8u)*Item;
+            case 2 : return LittleEndian2int16u(Item);
+            case 4 : return LittleEndian2int32u(Item);
+            default: return LittleEndian2int64u(Item);
+        }
+    }
+};
+
 struct sgpd_prol_struct
 {
     int16s                      roll_distance;
@@ -546,9 +585,9 @@ private :
             int32u SamplesPerChunk;
         };
         std::vector<stsc_struct> stsc;
-        std::vector<int64u>     stsz;
+        sample_sizes            stsz;
         std::vector<int32u>     stsz_FirstSubSampleSize;
-        std::vector<int64u>     stsz_Total; //TODO: merge with stsz
+        sample_sizes            stsz_Total; //TODO: merge with stsz
         int64u                  stsz_StreamSize; //TODO: merge with stsz
         int64u                  stsz_MoreThan2_Count;
         std::vector<int64u>     stss; //Sync Sample, base=0
@@ -2067,6 +2067,10 @@ void File_Mpeg4::mdat()
     }
     if (File_Offset+Buffer_Offset>LastMdatPos)
         LastMdatPos=File_Offset+Buffer_Offset+Element_TotalSize_Get();
+    #if MEDIAINFO_PREFETCH
+        if (FirstMoovPos==(int64u)-1 && File_Size!=(int64u)-1 && File_Offset+Buffer_Offset+Element_TotalSize_Get()<File_Size)
+            Prefetch(File_Offset+Buffer_Offset+Element_TotalSize_Get(), File_Size-(File_Offset+Buffer_Offset+Element_TotalSize_Get())); //moov is after mdat
+    #endif //MEDIAINFO_PREFETCH
 
     //Parsing
     Skip_XX(Element_TotalSize_Get(),                            "Data");
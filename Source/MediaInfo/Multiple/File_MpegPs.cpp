@@ -2682,7 +2682,7 @@ void File_MpegPs::program_stream_map()
     Parser.Complete_Stream=new complete_stream;
     Parser.Complete_Stream->Streams.resize(0x100);
     for (size_t StreamID=0; StreamID<0x100; StreamID++)
-        Parser.Complete_Stream->Streams[StreamID]=new complete_stream::stream;
+        Parser.Complete_Stream->Stream_New(StreamID);
     Open_Buffer_Init(&Parser);
     Open_Buffer_Continue(&Parser);
     Finish(&Parser);
@@ -341,6 +341,11 @@ void File_MpegTs::Streams_Accept()
         else
             MpegTs_JumpTo_Begin=File_Size-MpegTs_JumpTo_End;
     }
+
+    #if MEDIAINFO_PREFETCH
+        if (Config->ParseSpeed<1.0 && Config->File_IsSeekable_Get() && MpegTs_JumpTo_End && MpegTs_JumpTo_Begin+MpegTs_JumpTo_End<File_Size)
+            Prefetch(File_Size-MpegTs_JumpTo_End, MpegTs_JumpTo_End); //End of the file is parsed later for the duration
+    #endif //MEDIAINFO_PREFETCH
 }
 
 //---------------------------------------------------------------------------
@@ -1489,30 +1494,10 @@ void File_MpegTs::Streams_Finish()
 //---------------------------------------------------------------------------
 bool File_MpegTs::Synchronize()
 {
-    //Synchronizing
-    while (       Buffer_Offset+188*16+BDAV_Size*16+TSP_Size*16<=Buffer_Size
-      && !(Buffer[Buffer_Offset+188* 0+BDAV_Size* 1+TSP_Size* 0]==0x47
-        && Buffer[Buffer_Offset+188* 1+BDAV_Size* 2+TSP_Size* 1]==0x47
-        && Buffer[Buffer_Offset+188* 2+BDAV_Size* 3+TSP_Size* 2]==0x47
-        && Buffer[Buffer_Offset+188* 3+BDAV_Size* 4+TSP_Size* 3]==0x47
-        && Buffer[Buffer_Offset+188* 4+BDAV_Size* 5+TSP_Size* 4]==0x47
-        && Buffer[Buffer_Offset+188* 5+BDAV_Size* 6+TSP_Size* 5]==0x47
-        && Buffer[Buffer_Offset+188* 6+BDAV_Size* 7+TSP_Size* 6]==0x47
-        && Buffer[Buffer_Offset+188* 7+BDAV_Size* 8+TSP_Size* 7]==0x47
-        && Buffer[Buffer_Offset+188* 8+BDAV_Size* 9+TSP_Size* 8]==0x47
-        && Buffer[Buffer_Offset+188* 9+BDAV_Size*10+TSP_Size* 9]==0x47
-        && Buffer[Buffer_Offset+188*10+BDAV_Size*11+TSP_Size*10]==0x47
-        && Buffer[Buffer_Offset+188*11+BDAV_Size*12+TSP_Size*11]==0x47
-        && Buffer[Buffer_Offset+188*12+BDAV_Size*13+TSP_Size*12]==0x47
-        && Buffer[Buffer_Offset+188*13+BDAV_Size*14+TSP_Size*13]==0x47
-        && Buffer[Buffer_Offset+188*14+BDAV_Size*15+TSP_Size*14]==0x47
-        && Buffer[Buffer_Offset+188*15+BDAV_Size*16+TSP_Size*15]==0x47))
-    {
-        Buffer_Offset++;
-        while (       Buffer_Offset+BDAV_Size+1<=Buffer_Size
-            && Buffer[Buffer_Offset+BDAV_Size]!=0x47)
-            Buffer_Offset++;
-    }
+    //Synchronizing, 16 consecutive packets must begin with 0x47
+    size_t Packet_Size=188+BDAV_Size+TSP_Size;
+    if (Buffer_Offset+Packet_Size*16<=Buffer_Size)
+        Buffer_Offset=Find_Byte_Strided(Buffer, Buffer_Offset, Buffer_Size-Packet_Size*16+1, BDAV_Size, Packet_Size, 16, 0x47);
 
     if (Buffer_Offset+188*16+BDAV_Size*16+TSP_Size*16>=Buffer_Size
     #ifdef MEDIAINFO_ARIBSTDB24B37_YES
@@ -1548,6 +1533,18 @@ bool File_MpegTs::Synched_Test()
         pid=(Buffer[Buffer_Offset+BDAV_Size+1]&0x1F)<<8
           |  Buffer[Buffer_Offset+BDAV_Size+2];
 
+        //Skipping quickly packets nobody is interested in
+        if (!Complete_Stream->Streams_Searching[pid]
+        #if MEDIAINFO_DUPLICATE
+         && Complete_Stream->Duplicates.empty()
+        #endif //MEDIAINFO_DUPLICATE
+        )
+        {
+            Header_Parse_Events();
+            Buffer_Offset+=TS_Size;
+            continue;
+        }
+
         complete_stream::stream* Stream=Complete_Stream->Streams[pid];
         if (Stream->Searching)
         {
@@ -1938,7 +1935,7 @@ void File_MpegTs::Synched_Init()
     Complete_Stream=new complete_stream;
     Complete_Stream->Streams.resize(0x2000);
     for (size_t StreamID=0; StreamID<0x2000; StreamID++)
-        Complete_Stream->Streams[StreamID]=new complete_stream::stream;
+        Complete_Stream->Stream_New(StreamID);
     Complete_Stream->Streams[0x0000]->init(0x00); // program_association_section
     Complete_Stream->Streams[0x0001]->init(0x01); // CA_section
     Complete_Stream->Streams[0x0002]->Searching_Payload_Start_Set(true);
@@ -3392,9 +3389,7 @@ void File_MpegTs::SetAllToPES()
 {
     Complete_Stream->Streams_NotParsedCount=(size_t)-1;
     for (size_t StreamID=0; StreamID<0x2000; StreamID++)
-    {
-        delete Complete_Stream->Streams[StreamID]; Complete_Stream->Streams[StreamID]=new complete_stream::stream;
-    }
+        Complete_Stream->Stream_New(StreamID);
     #ifdef MEDIAINFO_ARIBSTDB24B37_YES
         size_t StreamID=FromAribStdB24B37?0x00:0x20;
     #else //MEDIAINFO_ARIBSTDB24B37_YES
@@ -21,6 +21,7 @@
 #if defined(MEDIAINFO_EIA608_YES) || defined(MEDIAINFO_EIA708_YES)
     #include "MediaInfo/File__Analyze.h"
 #endif
+#include <algorithm>
 #include <cfloat>
 #include <set>
 //---------------------------------------------------------------------------
@@ -372,6 +373,7 @@ struct complete_stream
         int8u                                       DtsNeural_config_id;
         bool                                        FMC_ES_ID_IsValid;
         bool                                        Searching;
+        bool*                                       Searching_Shadow; //If not NULL, kept equal to Searching
         bool                                        Searching_Payload_Start;
         bool                                        Searching_Payload_Continue;
         #ifdef MEDIAINFO_MPEGTS_PCR_YES
@@ -441,6 +443,7 @@ struct complete_stream
             DtsNeural_config_id=(int8u)-1;
             FMC_ES_ID_IsValid=false;
             Searching=false;
+            Searching_Shadow=NULL;
             Searching_Payload_Start=false;
             Searching_Payload_Continue=false;
             #ifdef MEDIAINFO_MPEGTS_PCR_YES
@@ -524,6 +527,8 @@ struct complete_stream
                         | Searching_ParserTimeStamp_End
                     #endif //MEDIAINFO_MPEGTS_PESTIMESTAMP_YES
                     ;
+            if (Searching_Shadow)
+                *Searching_Shadow=Searching;
         }
         void init(const size_t ID)
         {
@@ -535,6 +540,14 @@ struct complete_stream
     };
     typedef std::vector<stream*> streams;
     streams Streams; //Key is pid
+    bool Streams_Searching[0x2000]; //Key is pid, copy of Streams[pid]->Searching in a flat table for skipping quickly packets nobody is interested in
+    void Stream_New(size_t pid) //Replaces the stream of this pid by a new one
+    {
+        delete Streams[pid];
+        Streams[pid]=new stream;
+        Streams[pid]->Searching_Shadow=Streams_Searching+pid;
+        Streams_Searching[pid]=false;
+    }
     size_t Streams_NotParsedCount;
     size_t Streams_With_StartTimeStampCount;
     size_t Streams_With_EndTimeStampMoreThanxSecondsCount;
@@ -629,6 +642,7 @@ struct complete_stream
         Sources_IsUpdated=false;
         Programs_IsUpdated=false;
         StreamPos_ToRemove.resize(Stream_Max);
+        std::fill(Streams_Searching, Streams_Searching+0x2000, false);
         #if MEDIAINFO_DUPLICATE
         File__Duplicate_HasChanged_ = false;
         Config_File_Duplicate_Get_AlwaysNeeded_Count = 0;
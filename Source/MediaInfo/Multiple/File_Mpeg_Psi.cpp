@@ -2556,7 +2556,7 @@ void File_Mpeg_Psi::program_number_Remove()
 
             if (Complete_Stream->Streams_NotParsedCount!=(size_t)-1 && Complete_Stream->Streams_NotParsedCount && !Complete_Stream->Streams[elementary_PID_Temp]->IsParsed)
                 Complete_Stream->Streams_NotParsedCount--; //Not parsed, and no need to parse it now
-            delete Complete_Stream->Streams[elementary_PID_Temp]; Complete_Stream->Streams[elementary_PID_Temp]=new complete_stream::stream;
+            Complete_Stream->Stream_New(elementary_PID_Temp);
         }
     }
 
@@ -2602,12 +2602,12 @@ void File_Mpeg_Psi::elementary_PID_Update(int16u PCR_PID)
     {
         if (Complete_Stream->Streams_NotParsedCount!=(size_t)-1 && Complete_Stream->Streams_NotParsedCount && !Complete_Stream->Streams[elementary_PID]->IsParsed)
             Complete_Stream->Streams_NotParsedCount--; //Not parsed, and no need to parse it now
-        delete Complete_Stream->Streams[elementary_PID]; Complete_Stream->Streams[elementary_PID]=new complete_stream::stream;
+        Complete_Stream->Stream_New(elementary_PID);
         Complete_Stream->Streams[elementary_PID]->Kind=complete_stream::stream::unknown;
     }
     if (Complete_Stream->Streams[elementary_PID]->Kind!=complete_stream::stream::pes)
     {
-        delete Complete_Stream->Streams[elementary_PID]; Complete_Stream->Streams[elementary_PID]=new complete_stream::stream;
+        Complete_Stream->Stream_New(elementary_PID);
 
         if (Complete_Stream->Streams_NotParsedCount==(size_t)-1)
             Complete_Stream->Streams_NotParsedCount=0;
@@ -2690,7 +2690,7 @@ void File_Mpeg_Psi::elementary_PID_Remove()
 
         if (Complete_Stream->Streams_NotParsedCount!=(size_t)-1 && Complete_Stream->Streams_NotParsedCount && !Complete_Stream->Streams[elementary_PID]->IsParsed)
             Complete_Stream->Streams_NotParsedCount--; //Not parsed, and no need to parse it now
-        delete Complete_Stream->Streams[elementary_PID]; Complete_Stream->Streams[elementary_PID]=new complete_stream::stream;
+        Complete_Stream->Stream_New(elementary_PID);
         Complete_Stream->PES_PIDs.erase(elementary_PID);
     }
 }
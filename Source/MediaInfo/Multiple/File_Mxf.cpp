@@ -115,9 +115,7 @@
 #if MEDIAINFO_ADVANCED
     #include <limits>
 #endif //MEDIAINFO_ADVANCED
-#if MEDIAINFO_SEEK
-    #include <algorithm>
-#endif //MEDIAINFO_SEEK
+#include <algorithm>
 using namespace std;
 //---------------------------------------------------------------------------
 
@@ -1929,6 +1927,7 @@ File_Mxf::File_Mxf()
     HeaderPartition_IsOpen=false;
     Is1001=false;
     IdIsAlwaysSame_Offset=0;
+    Primer_Value_Current=Primer_Values.end();
     PartitionMetadata_PreviousPartition=(int64u)-1;
     PartitionMetadata_FooterPartition=(int64u)-1;
     RandomIndexPacks_MaxOffset=(int64u)-1;
@@ -6024,9 +6023,10 @@ void File_Mxf::Data_Parse()
                     Get_B2(Length2,                             "Length");
                 }
                 Element_End0();
+                Primer_Value_Current = Primer_Values.find(Code2); //Resolved once per item, reused by the local tag handlers
                 #if MEDIAINFO_TRACE
                 if (Trace_Activated) {
-                    std::map<int16u, int128u>::iterator Primer_Value = Primer_Values.find(Code2);
+                    std::map<int16u, int128u>::iterator Primer_Value = Primer_Value_Current;
                     if (Primer_Value != Primer_Values.end()) {
                         auto Name = Mxf_Param_Info((int32u)Primer_Value->second.hi, Primer_Value->second.lo);
                         Element_Name(Name ? Name : Ztring().From_UUID(Primer_Value->second).To_UTF8().c_str());
@@ -6069,6 +6069,113 @@ void File_Mxf::Data_Parse()
     }
     */
 
+    //Groups, sorted once for a binary search on the key
+    struct group_handler
+    {
+        int64u      Key;
+        method_name Method;
+        bool operator < (const group_handler &Other) const {return Key<Other.Key;}
+    };
+    #define GROUP_HANDLER(_ELEMENT) {Groups::_ELEMENT, &File_Mxf::_ELEMENT},
+    #define GROUPSTATIC_HANDLER(_ELEMENT) {GroupsPacks::_ELEMENT, &File_Mxf::_ELEMENT},
+    static group_handler Group_Handlers[]=
+    {
+        GROUP_HANDLER(LensUnitAcquisitionMetadata)
+        GROUP_HANDLER(CameraUnitAcquisitionMetadata)
+        GROUP_HANDLER(UserDefinedAcquisitionMetadata)
+        GROUP_HANDLER(FillerGroup)
+        GROUP_HANDLER(Sequence)
+        GROUP_HANDLER(SourceClip)
+        GROUP_HANDLER(TimecodeGroup)
+        GROUP_HANDLER(ContentStorage)
+        GROUP_HANDLER(EssenceData)
+        GROUP_HANDLER(PictureDescriptor)
+        GROUP_HANDLER(CDCIDescriptor)
+        GROUP_HANDLER(RGBADescriptor)
+        GROUP_HANDLER(Preface)
+        GROUP_HANDLER(Identification)
+        GROUP_HANDLER(NetworkLocator)
+        GROUP_HANDLER(TextLocator)
+        GROUP_HANDLER(StereoscopicPictureSubDescriptor)
+        GROUP_HANDLER(MaterialPackage)
+        GROUP_HANDLER(SourcePackage)
+        GROUP_HANDLER(EventTrack)
+        GROUP_HANDLER(StaticTrack)
+        GROUP_HANDLER(TimelineTrack)
+        GROUP_HANDLER(DescriptiveMarker)
+        GROUP_HANDLER(SoundDescriptor)
+        GROUP_HANDLER(DataEssenceDescriptor)
+        GROUP_HANDLER(MultipleDescriptor)
+        GROUP_HANDLER(DescriptiveClip)
+        GROUP_HANDLER(AES3PCMDescriptor)
+        GROUP_HANDLER(WAVEPCMDescriptor)
+        GROUP_HANDLER(MPEGVideoDescriptor)
+        GROUP_HANDLER(JPEG2000SubDescriptor)
+        GROUP_HANDLER(VBIDataDescriptor)
+        GROUP_HANDLER(ANCDataDescriptor)
+        GROUP_HANDLER(MPEGAudioDescriptor)
+        GROUP_HANDLER(ApplicationPlugInObject)
+        GROUP_HANDLER(ApplicationReferencedObject)
+        GROUP_HANDLER(MCALabelSubDescriptor)
+        GROUP_HANDLER(DCTimedTextDescriptor)
+        GROUP_HANDLER(DCTimedTextResourceSubDescriptor)
+        GROUP_HANDLER(ContainerConstraintsSubDescriptor)
+        GROUP_HANDLER(MPEG4VisualSubDescriptor)
+        GROUP_HANDLER(AudioChannelLabelSubDescriptor)
+        GROUP_HANDLER(SoundfieldGroupLabelSubDescriptor)
+        GROUP_HANDLER(GroupOfSoundfieldGroupsLabelSubDescriptor)
+        GROUP_HANDLER(AVCSubDescriptor)
+        GROUP_HANDLER(IABEssenceDescriptor)
+        GROUP_HANDLER(IABSoundfieldLabelSubDescriptor)
+        GROUPSTATIC_HANDLER(HeaderPartitionOpenIncomplete)
+        GROUPSTATIC_HANDLER(HeaderPartitionClosedIncomplete)
+        GROUPSTATIC_HANDLER(HeaderPartitionOpenComplete)
+        GROUPSTATIC_HANDLER(HeaderPartitionClosedComplete)
+        GROUPSTATIC_HANDLER(BodyPartitionOpenIncomplete)
+        GROUPSTATIC_HANDLER(BodyPartitionClosedIncomplete)
+        GROUPSTATIC_HANDLER(BodyPartitionOpenComplete)
+        GROUPSTATIC_HANDLER(BodyPartitionClosedComplete)
+        GROUPSTATIC_HANDLER(GenericStreamPartition)
+        GROUPSTATIC_HANDLER(FooterPartitionClosedIncomplete)
+        GROUPSTATIC_HANDLER(FooterPartitionClosedComplete)
+        GROUPSTATIC_HANDLER(PrimerPack)
+        GROUP_HANDLER(IndexTableSegment)
+        GROUPSTATIC_HANDLER(RandomIndexPack)
+        GROUP_HANDLER(SDTISystemMetadataPack)
+        GROUP_HANDLER(DM_AS_11_Core_Framework)
+        GROUP_HANDLER(DM_AS_11_Segmentation_Framework)
+        GROUP_HANDLER(DM_AS_11_UKDPP_Framework)
+        GROUP_HANDLER(ProductionFramework)
+        GROUP_HANDLER(TextBasedFramework)
+        GROUP_HANDLER(GenericStreamTextBasedSet)
+        GROUP_HANDLER(ISXDDataEssenceDescriptor)
+        GROUP_HANDLER(PHDRMetadataTrackSubDescriptor)
+        GROUP_HANDLER(OmneonVideoNetworksDescriptiveMetadataLinks)
+        GROUP_HANDLER(OmneonVideoNetworksDescriptiveMetadataData)
+        GROUP_HANDLER(HdrVividMetadataTrackSubDescriptor)
+        GROUP_HANDLER(FFV1PictureSubDescriptor)
+        GROUP_HANDLER(MGASoundEssenceDescriptor)
+        GROUP_HANDLER(MGAAudioMetadataSubDescriptor)
+        GROUP_HANDLER(MGASoundfieldGroupLabelSubDescriptor)
+        GROUP_HANDLER(SADMAudioMetadataSubDescriptor)
+        GROUP_HANDLER(RIFFChunkDefinitionSubDescriptor)
+        GROUP_HANDLER(ADM_CHNASubDescriptor)
+        GROUP_HANDLER(ADMChannelMapping)
+        GROUP_HANDLER(RIFFChunkReferencesSubDescriptor)
+        GROUP_HANDLER(ADMAudioMetadataSubDescriptor)
+        GROUP_HANDLER(ADMSoundfieldGroupLabelSubDescriptor)
+    };
+    #undef GROUP_HANDLER
+    #undef GROUPSTATIC_HANDLER
+    static const size_t Group_Handlers_Size=sizeof(Group_Handlers)/sizeof(group_handler);
+    static const bool Group_Handlers_Sorted=(std::stable_sort(Group_Handlers, Group_Handlers+Group_Handlers_Size), true); //Thread-safe initialization of local statics
+    (void)Group_Handlers_Sorted;
+    auto Group_Handler_Find = [&](int64u Key) -> const group_handler* {
+        group_handler ToFind={Key, nullptr};
+        const group_handler* Handler=std::lower_bound(Group_Handlers, Group_Handlers+Group_Handlers_Size, ToFind);
+        return (Handler!=Group_Handlers+Group_Handlers_Size && Handler->Key==Key)?Handler:nullptr;
+    };
+
     //Parsing
     switch (Code.hi >> 8) {
     case 0x060E2B34010201LL: {
@@ -6744,69 +6851,10 @@ void File_Mxf::Data_Parse()
     if (IsArriExperimental && Code.lo == 0x0F01010101010100LL) {
         Code.lo = Groups::PictureDescriptor;
     }
-    if (false) {}
-    GROUP(LensUnitAcquisitionMetadata)
-    GROUP(CameraUnitAcquisitionMetadata)
-    GROUP(UserDefinedAcquisitionMetadata)
-    GROUP(FillerGroup)
-    GROUP(Sequence)
-    GROUP(SourceClip)
-    GROUP(TimecodeGroup)
-    GROUP(ContentStorage)
-    GROUP(EssenceData)
-    GROUP(PictureDescriptor)
-    GROUP(CDCIDescriptor)
-    GROUP(RGBADescriptor)
-    GROUP(Preface)
-    GROUP(Identification)
-    GROUP(NetworkLocator)
-    GROUP(TextLocator)
-    GROUP(StereoscopicPictureSubDescriptor)
-    GROUP(MaterialPackage)
-    GROUP(SourcePackage)
-    GROUP(EventTrack)
-    GROUP(StaticTrack)
-    GROUP(TimelineTrack)
-    GROUP(DescriptiveMarker)
-    GROUP(SoundDescriptor)
-    GROUP(DataEssenceDescriptor)
-    GROUP(MultipleDescriptor)
-    GROUP(DescriptiveClip)
-    GROUP(AES3PCMDescriptor)
-    GROUP(WAVEPCMDescriptor)
-    GROUP(MPEGVideoDescriptor)
-    GROUP(JPEG2000SubDescriptor)
-    GROUP(VBIDataDescriptor)
-    GROUP(ANCDataDescriptor)
-    GROUP(MPEGAudioDescriptor)
-    GROUP(ApplicationPlugInObject)
-    GROUP(ApplicationReferencedObject)
-    GROUP(MCALabelSubDescriptor)
-    GROUP(DCTimedTextDescriptor)
-    GROUP(DCTimedTextResourceSubDescriptor)
-    GROUP(ContainerConstraintsSubDescriptor)
-    GROUP(MPEG4VisualSubDescriptor)
-    GROUP(AudioChannelLabelSubDescriptor)
-    GROUP(SoundfieldGroupLabelSubDescriptor)
-    GROUP(GroupOfSoundfieldGroupsLabelSubDescriptor)
-    GROUP(AVCSubDescriptor)
-    GROUP(IABEssenceDescriptor)
-    GROUP(IABSoundfieldLabelSubDescriptor)
-    GROUPSTATIC(HeaderPartitionOpenIncomplete)
-    GROUPSTATIC(HeaderPartitionClosedIncomplete)
-    GROUPSTATIC(HeaderPartitionOpenComplete)
-    GROUPSTATIC(HeaderPartitionClosedComplete)
-    GROUPSTATIC(BodyPartitionOpenIncomplete)
-    GROUPSTATIC(BodyPartitionClosedIncomplete)
-    GROUPSTATIC(BodyPartitionOpenComplete)
-    GROUPSTATIC(BodyPartitionClosedComplete)
-    GROUPSTATIC(GenericStreamPartition)
-    GROUPSTATIC(FooterPartitionClosedIncomplete)
-    GROUPSTATIC(FooterPartitionClosedComplete)
-    GROUPSTATIC(PrimerPack)
-    GROUP(IndexTableSegment)
-    GROUPSTATIC(RandomIndexPack)
-    GROUP(SDTISystemMetadataPack)
+    if (const group_handler* Handler=Group_Handler_Find(Code.lo))
+    {
+        ManageGroup(Handler->Method);
+    }
     else if ((Code.lo>>16)==(Groups::SDTISystemMetadataPack>>16))
     {
         Code_Compare4&=0xFFFFFF00; //Remove MetaData Block Count
@@ -6824,28 +6872,6 @@ void File_Mxf::Data_Parse()
         if (0) {}
         GROUP(SystemScheme1FirstElement)
     }
-    GROUP(DM_AS_11_Core_Framework)
-    GROUP(DM_AS_11_Segmentation_Framework)
-    GROUP(DM_AS_11_UKDPP_Framework)
-    GROUP(ProductionFramework)
-    GROUP(TextBasedFramework)
-    GROUP(GenericStreamTextBasedSet)
-    GROUP(ISXDDataEssenceDescriptor)
-    GROUP(PHDRMetadataTrackSubDescriptor)
-    GROUP(OmneonVideoNetworksDescriptiveMetadataLinks)
-    GROUP(OmneonVideoNetworksDescriptiveMetadataData)
-    GROUP(HdrVividMetadataTrackSubDescriptor)
-    GROUP(FFV1PictureSubDescriptor)
-    GROUP(MGASoundEssenceDescriptor)
-    GROUP(MGAAudioMetadataSubDescriptor)
-    GROUP(MGASoundfieldGroupLabelSubDescriptor)
-    GROUP(SADMAudioMetadataSubDescriptor)
-    GROUP(RIFFChunkDefinitionSubDescriptor)
-    GROUP(ADM_CHNASubDescriptor)
-    GROUP(ADMChannelMapping)
-    GROUP(RIFFChunkReferencesSubDescriptor)
-    GROUP(ADMAudioMetadataSubDescriptor)
-    GROUP(ADMSoundfieldGroupLabelSubDescriptor)
     else {
         ManageGroup((int8u)(Code.hi>>16)==0x53?&File_Mxf::UnknownGroupItem:&File_Mxf::UnknownElement);
     }
@@ -6908,7 +6934,7 @@ void File_Mxf::Data_Parse()
 #define ELEMENT_MIDDLE() \
     default: \
     { \
-        std::map<int16u, int128u>::iterator Primer_Value = Primer_Values.find(Code2); \
+        std::map<int16u, int128u>::iterator Primer_Value = Primer_Value_Current; \
         if (Primer_Value != Primer_Values.end()) \
         { \
             if (false); \
@@ -6922,15 +6948,6 @@ void File_Mxf::Data_Parse()
 #undef ELEMENT
 #define ELEMENT(_CODE, _CALL) \
     case 0x##_CODE :    { \
-                        std::map<int16u, int128u>::iterator Primer_Value=Primer_Values.find(0x##_CODE); \
-                        const char* Temp; \
-                        if (Primer_Value!=Primer_Values.end()) { \
-                            auto Temp = Mxf_Param_Info((int32u)Primer_Value->second.hi, Primer_Value->second.lo); \
-                            Element_Name(Temp ? Temp : Ztring().From_UUID(Code).To_UTF8().c_str()); \
-                        } \
-                        else { \
-                            Element_Name(Ztring().From_CC2(0x##_CODE).To_UTF8().c_str()); \
-                        } \
                         _CALL(); \
                         } \
                         break; \
@@ -6939,8 +6956,6 @@ void File_Mxf::Data_Parse()
 else if ((Primer_Value->second.hi>>24)==0x060E2B3401LL \
       && Primer_Value->second.lo==Elements::_ELEMENT) \
 { \
-    auto Temp = Mxf_Param_Info((int32u)Primer_Value->second.hi, Primer_Value->second.lo); \
-    Element_Name(Temp ? Temp : Ztring().From_UUID(Code).To_UTF8().c_str()); \
     int64u Element_Size_Save=Element_Size; \
     Element_Size=Element_Offset+Length2; \
     _ELEMENT(); \
@@ -6957,7 +6972,7 @@ void File_Mxf::UnknownElement()
 //---------------------------------------------------------------------------
 void File_Mxf::UnknownGroupItem()
 {
-    std::map<int16u, int128u>::iterator Primer_Value = Primer_Values.find(Code2);
+    std::map<int16u, int128u>::iterator Primer_Value = Primer_Value_Current;
     if (Primer_Value != Primer_Values.end()) {
         int8u Category = (int8u)(((int32u)Primer_Value->second.hi) >> 24);
         if (Category == 0x01) {
@@ -11431,6 +11446,10 @@ void File_Mxf::PartitionMetadata()
         PartitionMetadata_PreviousPartition=PreviousPartition;
     if (FooterPartition)
         PartitionMetadata_FooterPartition=FooterPartition;
+    #if MEDIAINFO_PREFETCH
+        if (Partitions.empty() && Config->ParseSpeed>-1 && FooterPartition && FooterPartition>File_Offset+Buffer_Offset+Element_Size && FooterPartition+17<=File_Size)
+            Prefetch(FooterPartition, File_Size-FooterPartition); //Footer partition and random index pack are parsed after the header metadata
+    #endif //MEDIAINFO_PREFETCH
     bool AlreadyParsed=false;
     for (size_t Pos=0; Pos<Partitions.size(); Pos++)
         if (Partitions[Pos].StreamOffset==File_Offset+Buffer_Offset-Header_Size)
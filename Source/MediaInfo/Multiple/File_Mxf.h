@@ -719,6 +719,7 @@ protected :
 
     //Primer
     std::map<int16u, int128u> Primer_Values;
+    std::map<int16u, int128u>::iterator Primer_Value_Current; //Entry of the local tag being parsed
 
     //Preface
     struct preface
@@ -99,6 +99,12 @@ std::string URL_Encoded_Encode(const std::string& URL)
 #if MEDIAINFO_AES
     #include "ThirdParty/base64/base64.h"
 #endif //MEDIAINFO_AES
+#if MEDIAINFO_REFERENCES_THREAD
+    #include <atomic>
+    #include <condition_variable>
+    #include <mutex>
+    #include <thread>
+#endif //MEDIAINFO_REFERENCES_THREAD
 using namespace std;
 //---------------------------------------------------------------------------
 
@@ -215,11 +221,18 @@ File__ReferenceFilesHelper::File__ReferenceFilesHelper(File__Analyze* MI_, Media
     #if MEDIAINFO_NEXTPACKET
         DTS_Interval=(int64u)-1;
     #endif //MEDIAINFO_NEXTPACKET
+    #if MEDIAINFO_REFERENCES_THREAD
+        Parallel=NULL;
+    #endif //MEDIAINFO_REFERENCES_THREAD
 }
 
 //---------------------------------------------------------------------------
 File__ReferenceFilesHelper::~File__ReferenceFilesHelper()
 {
+    #if MEDIAINFO_REFERENCES_THREAD
+        ParseReference_Parallel_Stop();
+    #endif //MEDIAINFO_REFERENCES_THREAD
+
     size_t Sequences_Size=Sequences.size();
     for (size_t Sequences_Pos=0; Sequences_Pos<Sequences_Size; ++Sequences_Pos)
         delete Sequences[Sequences_Pos];
@@ -933,6 +946,10 @@ void File__ReferenceFilesHelper::ParseReferences()
                 return;
             }
         #endif //MEDIAINFO_DEMUX && MEDIAINFO_NEXTPACKET
+
+        #if MEDIAINFO_REFERENCES_THREAD
+            ParseReference_Parallel();
+        #endif //MEDIAINFO_REFERENCES_THREAD
     }
 
     while (Sequences_Current<Sequences.size())
@@ -949,6 +966,10 @@ void File__ReferenceFilesHelper::ParseReferences()
         #endif //MEDIAINFO_NEXTPACKET
         for (sequences::iterator ReferenceTemp=Sequences.begin(); ReferenceTemp!=Sequences.end(); ++ReferenceTemp)
         {
+            #if MEDIAINFO_REFERENCES_THREAD
+                if ((*ReferenceTemp)->MI_ParallelPos!=(size_t)-1)
+                    continue; //Still owned by a parsing thread
+            #endif //MEDIAINFO_REFERENCES_THREAD
             if ((*ReferenceTemp)->MI)
             {
                 if ((*ReferenceTemp)->State<10000)
@@ -1046,6 +1067,9 @@ void File__ReferenceFilesHelper::ParseReferences()
 bool File__ReferenceFilesHelper::ParseReference_Init()
 {
     //Configuration
+    #if MEDIAINFO_REFERENCES_THREAD
+    if (Sequences[Sequences_Current]->MI_OpenResult==(size_t)-1)
+    #endif //MEDIAINFO_REFERENCES_THREAD
     Sequences[Sequences_Current]->MI=MI_Create();
     if (Config->ParseSpeed>=1)
     {
@@ -1155,7 +1179,17 @@ bool File__ReferenceFilesHelper::ParseReference_Init()
         #if MEDIAINFO_EVENTS
             SubFile_Start();
         #endif //MEDIAINFO_EVENTS
-        if (!Sequences[Sequences_Current]->MI->Open(Sequences[Sequences_Current]->FileNames.Read()))
+        size_t MiOpenResult;
+        #if MEDIAINFO_REFERENCES_THREAD
+        if (Sequences[Sequences_Current]->MI_OpenResult!=(size_t)-1)
+        {
+            MiOpenResult=Sequences[Sequences_Current]->MI_OpenResult; //Already parsed by ParseReference_Parallel()
+            Sequences[Sequences_Current]->MI_OpenResult=(size_t)-1;
+        }
+        else
+        #endif //MEDIAINFO_REFERENCES_THREAD
+            MiOpenResult=Sequences[Sequences_Current]->MI->Open(Sequences[Sequences_Current]->FileNames.Read());
+        if (!MiOpenResult)
         {
             #if MEDIAINFO_EVENTS
                 Config->Event_SubFile_Missing(Sequences[Sequences_Current]->Source);
@@ -1195,7 +1229,16 @@ bool File__ReferenceFilesHelper::ParseReference_Init()
 //---------------------------------------------------------------------------
 void File__ReferenceFilesHelper::ParseReference()
 {
-    if (Sequences[Sequences_Current]->MI==NULL && !Sequences[Sequences_Current]->FileNames.empty())
+    #if MEDIAINFO_REFERENCES_THREAD
+        if (Sequences[Sequences_Current]->MI_ParallelPos!=(size_t)-1)
+            ParseReference_Parallel_Wait();
+    #endif //MEDIAINFO_REFERENCES_THREAD
+
+    if ((Sequences[Sequences_Current]->MI==NULL
+        #if MEDIAINFO_REFERENCES_THREAD
+         || Sequences[Sequences_Current]->MI_OpenResult!=(size_t)-1
+        #endif //MEDIAINFO_REFERENCES_THREAD
+        ) && !Sequences[Sequences_Current]->FileNames.empty())
     {
         if (!ParseReference_Init())
             return;
@@ -1318,6 +1361,149 @@ void File__ReferenceFilesHelper::ParseReference()
     }
 }
 
+//---------------------------------------------------------------------------
+#if MEDIAINFO_REFERENCES_THREAD
+struct File__ReferenceFilesHelper::parallel
+{
+    sequences               ToOpen;
+    vector<bool>            ToOpen_IsDone; //Protected by Mutex
+    atomic<size_t>          ToOpen_Next;
+    mutex                   Mutex;
+    condition_variable      Condition;
+    vector<thread>          Threads;
+
+    void Worker();
+};
+
+//Parsing threads, shared by all instances and levels as referenced files may also have references
+static atomic<size_t> ParseReference_Parallel_Threads_Count(0);
+
+static size_t ParseReference_Parallel_Threads_Reserve(size_t Count)
+{
+    size_t Max=thread::hardware_concurrency();
+    size_t Current=ParseReference_Parallel_Threads_Count;
+    for (;;)
+    {
+        if (Current>=Max)
+            return 0;
+        size_t ToReserve=Count<Max-Current?Count:(Max-Current);
+        if (ParseReference_Parallel_Threads_Count.compare_exchange_weak(Current, Current+ToReserve))
+            return ToReserve;
+    }
+}
+
+void File__ReferenceFilesHelper::parallel::Worker()
+{
+    for (;;)
+    {
+        size_t Pos=ToOpen_Next++;
+        if (Pos>=ToOpen.size())
+            break;
+        size_t MiOpenResult=ToOpen[Pos]->MI->Open(ToOpen[Pos]->FileNames.Read());
+        {
+            lock_guard<mutex> Lock(Mutex);
+            ToOpen[Pos]->MI_OpenResult=MiOpenResult;
+            ToOpen_IsDone[Pos]=true;
+        }
+        Condition.notify_all();
+    }
+    ParseReference_Parallel_Threads_Count--;
+}
+
+void File__ReferenceFilesHelper::ParseReference_Parallel()
+{
+    //Only the plain "open then merge" path is done in advance, demux and event based parsing need the sequential order
+    if (Config->ParseSpeed>=1 || Parallel)
+        return;
+    #if MEDIAINFO_NEXTPACKET
+        if (Config->NextPacket_Get())
+            return;
+    #endif //MEDIAINFO_NEXTPACKET
+    #if MEDIAINFO_EVENTS
+        if (Config->Event_CallBackFunction_IsSet())
+            return;
+    #endif //MEDIAINFO_EVENTS
+
+    //Sequences to parse
+    sequences ToOpen;
+    for (size_t Pos=0; Pos<Sequences.size(); Pos++)
+        if (Sequences[Pos]->MI==NULL && !Sequences[Pos]->FileNames.empty() && !Sequences[Pos]->IsCircular && !Sequences[Pos]->Status[File__Analyze::IsFinished])
+            ToOpen.push_back(Sequences[Pos]);
+    if (ToOpen.size()<2)
+        return;
+    size_t Threads_Count=ParseReference_Parallel_Threads_Reserve(ToOpen.size());
+    if (!Threads_Count)
+        return; //All threads are already busy, e.g. by upper levels
+
+    //Configuration, in the sequence order as it depends on the previous sequences
+    Parallel=new parallel;
+    Parallel->ToOpen=ToOpen;
+    Parallel->ToOpen_IsDone.resize(ToOpen.size());
+    Parallel->ToOpen_Next=0;
+    size_t Sequences_Current_Save=Sequences_Current;
+    size_t ToOpen_Pos=0;
+    for (Sequences_Current=0; Sequences_Current<Sequences.size() && ToOpen_Pos<ToOpen.size(); Sequences_Current++)
+        if (Sequences[Sequences_Current]==ToOpen[ToOpen_Pos])
+        {
+            Sequences[Sequences_Current]->MI=MI_Create();
+            Sequences[Sequences_Current]->MI_ParallelPos=ToOpen_Pos++;
+        }
+    Sequences_Current=Sequences_Current_Save;
+
+    //Parsing, merge is done by ParseReference() in the sequence order as soon as the next sequence is parsed
+    for (size_t Pos=0; Pos<Threads_Count; Pos++)
+    {
+        try
+        {
+            Parallel->Threads.push_back(thread(&parallel::Worker, Parallel));
+        }
+        catch (...)
+        {
+            ParseReference_Parallel_Threads_Count-=Threads_Count-Pos;
+            break;
+        }
+    }
+    if (Parallel->Threads.empty())
+    {
+        //No thread, back to sequential parsing
+        for (size_t Pos=0; Pos<ToOpen.size(); Pos++)
+        {
+            delete ToOpen[Pos]->MI; ToOpen[Pos]->MI=NULL;
+            ToOpen[Pos]->MI_ParallelPos=(size_t)-1;
+        }
+        delete Parallel; Parallel=NULL;
+    }
+}
+
+void File__ReferenceFilesHelper::ParseReference_Parallel_Wait()
+{
+    size_t Pos=Sequences[Sequences_Current]->MI_ParallelPos;
+    {
+        unique_lock<mutex> Lock(Parallel->Mutex);
+        Parallel->Condition.wait(Lock, [this, Pos]{return Parallel->ToOpen_IsDone[Pos];});
+    }
+    Sequences[Sequences_Current]->MI_ParallelPos=(size_t)-1;
+
+    //Threads are no more needed after the last sequence
+    if (Pos+1==Parallel->ToOpen.size())
+        ParseReference_Parallel_Stop();
+}
+
+void File__ReferenceFilesHelper::ParseReference_Parallel_Stop()
+{
+    if (!Parallel)
+        return;
+
+    //Sequences not yet parsed are not parsed
+    Parallel->ToOpen_Next=Parallel->ToOpen.size();
+    for (size_t Pos=0; Pos<Parallel->Threads.size(); Pos++)
+        Parallel->Threads[Pos].join();
+    for (size_t Pos=0; Pos<Parallel->ToOpen.size(); Pos++)
+        Parallel->ToOpen[Pos]->MI_ParallelPos=(size_t)-1;
+    delete Parallel; Parallel=NULL;
+}
+#endif //MEDIAINFO_REFERENCES_THREAD
+
 //---------------------------------------------------------------------------
 void File__ReferenceFilesHelper::ParseReference_Finalize ()
 {
@@ -65,6 +65,11 @@ public:
 private :
     //Streams management
     void ParseReference ();
+    #if MEDIAINFO_REFERENCES_THREAD
+    void ParseReference_Parallel ();
+    void ParseReference_Parallel_Wait ();
+    void ParseReference_Parallel_Stop ();
+    #endif //MEDIAINFO_REFERENCES_THREAD
     void ParseReference_Finalize ();
     void ParseReference_Finalize_PerStream ();
     void Open_Buffer_Unsynch() {Read_Buffer_Unsynched();}
@@ -88,6 +93,10 @@ private :
         int64u                      DTS_Minimal;
         int64u                      DTS_Interval;
     #endif //MEDIAINFO_NEXTPACKET
+    #if MEDIAINFO_REFERENCES_THREAD
+        struct parallel;
+        parallel*                   Parallel;
+    #endif //MEDIAINFO_REFERENCES_THREAD
 
     //Helpers
     size_t Stream_Prepare(stream_t StreamKind, size_t StreamPos=(size_t)-1);
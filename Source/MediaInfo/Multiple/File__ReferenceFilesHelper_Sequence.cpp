@@ -59,6 +59,10 @@ sequence::sequence()
         List_Compute_Done=false;
     #endif //MEDIAINFO_ADVANCED || MEDIAINFO_HASH
     MI=NULL;
+    #if MEDIAINFO_REFERENCES_THREAD
+        MI_OpenResult=(size_t)-1;
+        MI_ParallelPos=(size_t)-1;
+    #endif //MEDIAINFO_REFERENCES_THREAD
 }
 
 //---------------------------------------------------------------------------
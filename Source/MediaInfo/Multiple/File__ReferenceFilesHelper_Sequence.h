@@ -72,6 +72,10 @@ public:
     bool                FileSize_IsPresent; //TODO: merge with FileSize after regression tests
     MediaInfo_Internal* MI;
     std::bitset<32> Status;
+    #if MEDIAINFO_REFERENCES_THREAD
+        size_t          MI_OpenResult; //Result of MI->Open() when parsed in advance, (size_t)-1 if not
+        size_t          MI_ParallelPos; //Position in the list parsed in advance by other threads, (size_t)-1 if not or if parsing is finished
+    #endif //MEDIAINFO_REFERENCES_THREAD
 };
 
 typedef std::vector<sequence*> sequences;
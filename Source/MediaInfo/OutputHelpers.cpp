@@ -77,10 +77,27 @@ string XML_Encode (const string& Data)
 }
 
 //---------------------------------------------------------------------------
-string To_XML (Node& Cur_Node, const int& Level, bool Print_Header, bool Indent)
+static void RawContent_Offsets_Shift(vector<size_t>* RawContent_Offsets, size_t From, size_t Shift)
+{
+    //Positions reported by a sub-call are relative to its result, now appended at Shift
+    if (!RawContent_Offsets)
+        return;
+    for (size_t Pos=From; Pos<RawContent_Offsets->size(); Pos++)
+        (*RawContent_Offsets)[Pos]+=Shift;
+}
+
+//---------------------------------------------------------------------------
+string To_XML (Node& Cur_Node, const int& Level, bool Print_Header, bool Indent, vector<size_t>* RawContent_Offsets)
 {
     string Result;
 
+    if (Cur_Node.RawContent_IsDeferred)
+    {
+        if (RawContent_Offsets)
+            RawContent_Offsets->push_back(0);
+        return Result;
+    }
+
     if (!Cur_Node.RawContent.empty())
     {
       //  if (Level)
@@ -175,7 +192,10 @@ string To_XML (Node& Cur_Node, const int& Level, bool Print_Header, bool Indent)
                 continue;
 
             Cur_Node.Childs[Pos]->AlreadyCommented=Cur_Node.AlreadyCommented;
-            Result+=To_XML(*Cur_Node.Childs[Pos], Level+1, false, Indent);
+            size_t Offsets_Size=RawContent_Offsets?RawContent_Offsets->size():0;
+            size_t Result_Size=Result.size();
+            Result+=To_XML(*Cur_Node.Childs[Pos], Level+1, false, Indent, RawContent_Offsets);
+            RawContent_Offsets_Shift(RawContent_Offsets, Offsets_Size, Result_Size);
             delete Cur_Node.Childs[Pos];
             Cur_Node.Childs[Pos]=NULL;
         }
@@ -238,7 +258,7 @@ string To_JSON_Attributes(Node& Cur_Node, const int& Level, bool Indent, bool Ca
 }
 
 //---------------------------------------------------------------------------
-string To_JSON_Elements(Node& Cur_Node, const int& Level, bool Indent, bool Carriage_Returns)
+string To_JSON_Elements(Node& Cur_Node, const int& Level, bool Indent, bool Carriage_Returns, vector<size_t>* RawContent_Offsets)
 {
     string Result;
 
@@ -247,11 +267,14 @@ string To_JSON_Elements(Node& Cur_Node, const int& Level, bool Indent, bool Carr
         if (!Cur_Node.Childs[Pos])
             continue;
 
-        if (!Cur_Node.Childs[Pos]->RawContent.empty())
+        if (!Cur_Node.Childs[Pos]->RawContent.empty() || Cur_Node.Childs[Pos]->RawContent_IsDeferred)
         {
             if (Level && Carriage_Returns)
                 Result+='\n';
-            Result+=Cur_Node.Childs[Pos]->RawContent;
+            if (!Cur_Node.Childs[Pos]->RawContent_IsDeferred)
+                Result+=Cur_Node.Childs[Pos]->RawContent;
+            else if (RawContent_Offsets)
+                RawContent_Offsets->push_back(Result.size());
 
             delete Cur_Node.Childs[Pos];
             Cur_Node.Childs[Pos]=NULL;
@@ -289,7 +312,10 @@ string To_JSON_Elements(Node& Cur_Node, const int& Level, bool Indent, bool Carr
             {
                 Result+=(Indent?string(Level+1, '\t'):string())+"{";
                 Result+=To_JSON_Attributes(*Cur_Node.Childs[Pos2], Level+2, Indent, Carriage_Returns);
-                Result+=To_JSON_Elements(*Cur_Node.Childs[Pos2], Level+2, Indent, Carriage_Returns);
+                size_t Offsets_Size=RawContent_Offsets?RawContent_Offsets->size():0;
+                size_t Result_Size=Result.size();
+                Result+=To_JSON_Elements(*Cur_Node.Childs[Pos2], Level+2, Indent, Carriage_Returns, RawContent_Offsets);
+                RawContent_Offsets_Shift(RawContent_Offsets, Offsets_Size, Result_Size);
                 if (Carriage_Returns)
                     Result+='\n';
 
@@ -323,15 +349,18 @@ string To_JSON_Elements(Node& Cur_Node, const int& Level, bool Indent, bool Carr
 }
 
 //---------------------------------------------------------------------------
-string To_JSON (Node& Cur_Node, const int& Level, bool Print_Header, bool Indent, bool Carriage_Returns)
+string To_JSON (Node& Cur_Node, const int& Level, bool Print_Header, bool Indent, bool Carriage_Returns, vector<size_t>* RawContent_Offsets)
 {
     string Result;
 
-    if (!Cur_Node.RawContent.empty())
+    if (!Cur_Node.RawContent.empty() || Cur_Node.RawContent_IsDeferred)
     {
         if (Level && Carriage_Returns)
             Result+='\n';
-        Result+=Cur_Node.RawContent;
+        if (!Cur_Node.RawContent_IsDeferred)
+            Result+=Cur_Node.RawContent;
+        else if (RawContent_Offsets)
+            RawContent_Offsets->push_back(Result.size());
         return Result;
     }
 
@@ -356,7 +385,10 @@ string To_JSON (Node& Cur_Node, const int& Level, bool Print_Header, bool Indent
 
     Result+="{";
     Result+=To_JSON_Attributes(Cur_Node, Level+2, Indent, Carriage_Returns);
-    Result+=To_JSON_Elements(Cur_Node, Level+2, Indent, Carriage_Returns);
+    size_t Offsets_Size=RawContent_Offsets?RawContent_Offsets->size():0;
+    size_t Result_Size=Result.size();
+    Result+=To_JSON_Elements(Cur_Node, Level+2, Indent, Carriage_Returns, RawContent_Offsets);
+    RawContent_Offsets_Shift(RawContent_Offsets, Offsets_Size, Result_Size);
     if (!Cur_Node.Value.empty())
         Result+=(Carriage_Returns?("\n"+(Indent?string(Level+2, '\t'):string())):string())+"\"#value\": \""+JSON_Encode(Cur_Node.Value)+"\"";
 
@@ -13,6 +13,8 @@
 #include "MediaInfo/MediaInfo_Internal.h"
 #include <ZenLib/Ztring.h>
 #include <string>
+#include <streambuf>
+#include <vector>
 //---------------------------------------------------------------------------
 
 namespace MediaInfoLib
@@ -34,6 +36,7 @@ struct Node
     std::string XmlComment; //If set, add comment after element data
     std::string XmlCommentOut; //If set, comment out the whole node in the xml output with the string as comment
     std::string RawContent; //If set, replace the whole node by the string
+    bool RawContent_IsDeferred=false; //If set, replace the whole node by nothing, its position in the output is reported to the caller
     bool Multiple;
     bool AlreadyCommented=false;
 
@@ -230,8 +233,52 @@ struct Node
     }
 };
 
-std::string To_XML (Node& Cur_Node, const int& Level, bool Print_Header=false, bool Indent=true);
-std::string To_JSON (Node& Cur_Node, const int& Level, bool Print_Header=false, bool Indent=true, bool Carriage_Returns=true);
+//RawContent_Offsets: if not NULL, filled with the positions of nodes with RawContent_IsDeferred
+std::string To_XML (Node& Cur_Node, const int& Level, bool Print_Header=false, bool Indent=true, std::vector<size_t>* RawContent_Offsets=NULL);
+std::string To_JSON (Node& Cur_Node, const int& Level, bool Print_Header=false, bool Indent=true, bool Carriage_Returns=true, std::vector<size_t>* RawContent_Offsets=NULL);
+
+#if MEDIAINFO_EVENTS
+//Output stream buffer sending content to the Inform callback by chunks, so memory usage stays bounded
+class Inform_Sink : public std::streambuf
+{
+public:
+    Inform_Sink(MediaInfo_Config_MediaInfo& Config_, size_t Buffer_Size=64*1024) : Config(Config_), Buffer(Buffer_Size)
+    {
+        setp(&Buffer[0], &Buffer[0]+Buffer.size());
+    }
+    ~Inform_Sink()
+    {
+        Flush();
+    }
+
+protected:
+    int_type overflow(int_type C) override
+    {
+        Flush();
+        if (!traits_type::eq_int_type(C, traits_type::eof()))
+        {
+            *pptr()=traits_type::to_char_type(C);
+            pbump(1);
+        }
+        return traits_type::not_eof(C);
+    }
+    int sync() override
+    {
+        Flush();
+        return 0;
+    }
+
+private:
+    void Flush()
+    {
+        Config.Inform_Send(pbase(), pptr()-pbase());
+        setp(&Buffer[0], &Buffer[0]+Buffer.size());
+    }
+
+    MediaInfo_Config_MediaInfo& Config;
+    std::vector<char> Buffer;
+};
+#endif //MEDIAINFO_EVENTS
 
 bool ExternalMetadata(const ZenLib::Ztring& FileName, const ZenLib::Ztring& ExternalMetadata, const ZenLib::Ztring& ExternalMetaDataConfig, const ZenLib::ZtringList& Parents, const  ZenLib::Ztring& PlaceHolder, Node* Main, Node* MI_Info);
 
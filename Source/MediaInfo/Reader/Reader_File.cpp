@@ -29,6 +29,18 @@
 #ifdef WINDOWS
     #undef __TEXT
     #include <windows.h>
+#else //WINDOWS
+    #if MEDIAINFO_PREFETCH || MEDIAINFO_MMAP
+        #include <unistd.h>
+    #endif //MEDIAINFO_PREFETCH || MEDIAINFO_MMAP
+    #if MEDIAINFO_PREFETCH && defined(_POSIX_PRIORITY_SCHEDULING) // Note: unistd.h must be included first
+        #include <sched.h>
+    #endif //MEDIAINFO_PREFETCH && defined(_POSIX_PRIORITY_SCHEDULING)
+    #if MEDIAINFO_MMAP
+        #include <fcntl.h>
+        #include <sys/mman.h>
+        #include <sys/stat.h>
+    #endif //MEDIAINFO_MMAP
 #endif //WINDOWS
 using namespace ZenLib;
 using namespace std;
@@ -119,7 +131,66 @@ void Reader_File_Thread::Entry()
 }
 #endif //MEDIAINFO_READTHREAD
 
+#if MEDIAINFO_PREFETCH
+void Reader_File_Prefetch::Entry()
+{
+    if (!F.Opened_Get())
+        F.Open(Base->Prefetch_FileName);
+
+    for (;;)
+    {
+        Reader_File::prefetch* Item=NULL;
+        if (!IsTerminating())
+        {
+        std::lock_guard<std::mutex> Lock(Base->Prefetch_Mutex);
+        for (size_t Pos=0; Pos<Base->Prefetch_Items.size(); Pos++)
+            if (!Base->Prefetch_Items[Pos]->IsStarted)
+            {
+                Item=Base->Prefetch_Items[Pos];
+                Item->IsStarted=true;
+                break;
+            }
+        }
+        if (!Item)
+            break; //Nothing more to read, the reader creates a new thread if needed
+
+        size_t BytesRead=0;
+        if (F.Opened_Get() && F.GoTo(Item->Offset))
+            BytesRead=F.Read(Item->Buffer, Item->Buffer_Max);
+
+        {
+        std::lock_guard<std::mutex> Lock(Base->Prefetch_Mutex);
+        Item->Buffer_Size=BytesRead;
+        Item->IsDone=true;
+        }
+        Base->Prefetch_Condition.notify_all();
+    }
+
+    std::lock_guard<std::mutex> Lock(Base->Prefetch_Mutex);
+    Base->Prefetch_Running--;
+    Base->Prefetch_Condition.notify_all();
+}
+#endif //MEDIAINFO_PREFETCH
+
 const size_t Buffer_NoJump=128*1024;
+#if MEDIAINFO_PREFETCH
+const size_t Prefetch_Size_Max=1024*1024;
+const size_t Prefetch_Items_Max=16;
+#endif //MEDIAINFO_PREFETCH
+
+//---------------------------------------------------------------------------
+Reader_File::Reader_File()
+{
+    MI_Internal=NULL;
+    #if MEDIAINFO_PREFETCH
+        Prefetch_Current=NULL;
+        Prefetch_Running=0;
+    #endif //MEDIAINFO_PREFETCH
+    #if MEDIAINFO_MMAP
+        MMap_Buffer=NULL;
+        MMap_Size=0;
+    #endif //MEDIAINFO_MMAP
+}
 
 //---------------------------------------------------------------------------
 Reader_File::~Reader_File()
@@ -127,6 +198,12 @@ Reader_File::~Reader_File()
     #if MEDIAINFO_READTHREAD
         Destroy_Thread(MI_Internal);
     #endif //MEDIAINFO_READTHREAD
+    #if MEDIAINFO_PREFETCH
+        Destroy_Prefetch();
+    #endif //MEDIAINFO_PREFETCH
+    #if MEDIAINFO_MMAP
+        MMap_Close(MI_Internal); //File buffer may still be a view of the mapping
+    #endif //MEDIAINFO_MMAP
 }
 
 //---------------------------------------------------------------------------
@@ -158,6 +235,257 @@ void Reader_File::Destroy_Thread(MediaInfo_Internal* MI)
 }
 #endif //MEDIAINFO_READTHREAD
 
+//---------------------------------------------------------------------------
+#if MEDIAINFO_PREFETCH
+static void Prefetch_Wait()
+{
+    #ifdef WINDOWS
+        Sleep(0);
+    #elif defined(_POSIX_PRIORITY_SCHEDULING)
+        sched_yield();
+    #endif //_POSIX_PRIORITY_SCHEDULING
+}
+
+//---------------------------------------------------------------------------
+void Reader_File::Prefetch_Dispatch(MediaInfo_Internal* MI)
+{
+    std::vector<std::pair<int64u, int64u> > Hints;
+    Hints.swap(MI->Config.File_Prefetch_Hints);
+    #if MEDIAINFO_MMAP
+        if (MMap_Buffer)
+            return; //Whole file is already mapped
+    #endif //MEDIAINFO_MMAP
+    size_t Threads_Max=MI->Config.File_Prefetch_Get();
+    if (!Threads_Max || MI->Config.File_Names.size()>1 || MI->Config.File_IsGrowing)
+        return; //Data may change or is split in several files
+
+    //Queuing the requests
+    int64u End=Partial_End<=MI->Config.File_Size?Partial_End:MI->Config.File_Size;
+    size_t ToRead=0;
+    {
+    std::lock_guard<std::mutex> Lock(Prefetch_Mutex);
+    for (size_t Pos=0; Pos<Hints.size(); Pos++)
+    {
+        int64u Offset=Partial_Begin+Hints[Pos].first;
+        if (Offset>=End || Prefetch_Items.size()>=Prefetch_Items_Max)
+            continue;
+        int64u Size=Hints[Pos].second;
+        if (Size>Prefetch_Size_Max)
+            Size=Prefetch_Size_Max;
+        if (Size>End-Offset)
+            Size=End-Offset;
+
+        bool IsPresent=false;
+        for (size_t Item_Pos=0; Item_Pos<Prefetch_Items.size(); Item_Pos++)
+            if (Offset>=Prefetch_Items[Item_Pos]->Offset && Offset+Size<=Prefetch_Items[Item_Pos]->Offset+Prefetch_Items[Item_Pos]->Buffer_Max)
+                IsPresent=true;
+        if (IsPresent)
+            continue;
+
+        prefetch* Item=new prefetch;
+        Item->Offset=Offset;
+        Item->Buffer_Max=(size_t)Size;
+        Item->Buffer=new int8u[Item->Buffer_Max];
+        Item->Buffer_Size=0;
+        Item->IsStarted=false;
+        Item->IsDone=false;
+        Prefetch_Items.push_back(Item);
+    }
+    for (size_t Pos=0; Pos<Prefetch_Items.size(); Pos++)
+        if (!Prefetch_Items[Pos]->IsStarted)
+            ToRead++;
+    }
+    if (!ToRead)
+        return;
+
+    //Threads, a thread exits when there is nothing more to read
+    size_t Running=0;
+    for (size_t Pos=0; Pos<Prefetch_Threads.size();)
+    {
+        if (Prefetch_Threads[Pos]->IsExited())
+        {
+            delete Prefetch_Threads[Pos];
+            Prefetch_Threads.erase(Prefetch_Threads.begin()+Pos);
+        }
+        else
+        {
+            Running++;
+            Pos++;
+        }
+    }
+    while (Running<Threads_Max && ToRead)
+    {
+        Reader_File_Prefetch* Worker=new Reader_File_Prefetch;
+        Worker->Base=this;
+        {
+        std::lock_guard<std::mutex> Lock(Prefetch_Mutex);
+        Prefetch_Running++;
+        }
+        if (Worker->Run()!=Thread::Ok)
+        {
+            std::lock_guard<std::mutex> Lock(Prefetch_Mutex);
+            Prefetch_Running--;
+            delete Worker;
+            break;
+        }
+        Prefetch_Threads.push_back(Worker);
+        Running++;
+        ToRead--;
+    }
+}
+
+//---------------------------------------------------------------------------
+bool Reader_File::Prefetch_Take(MediaInfo_Internal* MI, int64u GoTo)
+{
+    std::unique_lock<std::mutex> Lock(Prefetch_Mutex);
+    for (size_t Pos=0; Pos<Prefetch_Items.size(); Pos++)
+    {
+        prefetch* Item=Prefetch_Items[Pos];
+        if (GoTo<Item->Offset || GoTo>=Item->Offset+Item->Buffer_Max)
+            continue;
+
+        if (!Item->IsStarted)
+        {
+            //Not yet requested, reading it directly is not slower
+            Prefetch_Items.erase(Prefetch_Items.begin()+Pos);
+            Lock.unlock();
+            delete[] Item->Buffer;
+            delete Item;
+            return false;
+        }
+
+        //Waiting for the request in flight
+        Prefetch_Condition.wait(Lock, [Item]{return Item->IsDone;});
+        Prefetch_Items.erase(Prefetch_Items.begin()+Pos);
+        Lock.unlock();
+
+        if (GoTo>=Item->Offset+Item->Buffer_Size || !F.GoTo(Item->Offset+Item->Buffer_Size))
+        {
+            delete[] Item->Buffer;
+            delete Item;
+            return false; //Read error, normal seek
+        }
+
+        size_t Item_Offset=(size_t)(GoTo-Item->Offset);
+        if (Item_Offset)
+        {
+            Item->Buffer_Size-=Item_Offset;
+            memmove(Item->Buffer, Item->Buffer+Item_Offset, Item->Buffer_Size);
+        }
+        if (Prefetch_Current)
+        {
+            delete[] Prefetch_Current->Buffer;
+            delete Prefetch_Current;
+        }
+        Prefetch_Current=Item;
+        return true;
+    }
+    return false;
+}
+
+//---------------------------------------------------------------------------
+void Reader_File::Destroy_Prefetch()
+{
+    for (size_t Pos=0; Pos<Prefetch_Threads.size(); Pos++)
+        Prefetch_Threads[Pos]->RequestTerminate();
+    {
+    //Threads finish the read in flight, if any
+    std::unique_lock<std::mutex> Lock(Prefetch_Mutex);
+    Prefetch_Condition.wait(Lock, [this]{return !Prefetch_Running;});
+    }
+    for (size_t Pos=0; Pos<Prefetch_Threads.size(); Pos++)
+    {
+        while (!Prefetch_Threads[Pos]->IsExited())
+            Prefetch_Wait(); //Entry() is already returned, only the thread exit is remaining
+        delete Prefetch_Threads[Pos];
+    }
+    Prefetch_Threads.clear();
+
+    for (size_t Pos=0; Pos<Prefetch_Items.size(); Pos++)
+    {
+        delete[] Prefetch_Items[Pos]->Buffer;
+        delete Prefetch_Items[Pos];
+    }
+    Prefetch_Items.clear();
+
+    if (Prefetch_Current)
+    {
+        delete[] Prefetch_Current->Buffer;
+        delete Prefetch_Current; Prefetch_Current=NULL;
+    }
+}
+#endif //MEDIAINFO_PREFETCH
+
+//---------------------------------------------------------------------------
+#if MEDIAINFO_MMAP
+bool Reader_File::MMap_Open(const String &File_Name)
+{
+    #ifdef WINDOWS
+        HANDLE File=CreateFileW(Ztring(File_Name).To_Unicode().c_str(), GENERIC_READ, FILE_SHARE_READ|FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (File==INVALID_HANDLE_VALUE)
+            return false;
+        LARGE_INTEGER Size;
+        if (!GetFileSizeEx(File, &Size) || Size.QuadPart<=0 || (int64u)(size_t)Size.QuadPart!=(int64u)Size.QuadPart)
+        {
+            CloseHandle(File);
+            return false; //Empty file or not addressable
+        }
+        HANDLE Mapping=CreateFileMapping(File, NULL, PAGE_READONLY, 0, 0, NULL); //A mapped file can not be truncated by other processes
+        CloseHandle(File);
+        if (Mapping==NULL)
+            return false;
+        void* View=MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(Mapping); //The view keeps the mapping
+        if (View==NULL)
+            return false;
+        MMap_Size=(int64u)Size.QuadPart;
+    #else //WINDOWS
+        int File=open(Ztring(File_Name).To_Local().c_str(), O_RDONLY);
+        if (File<0)
+            return false;
+        struct stat Stat;
+        if (fstat(File, &Stat) || Stat.st_size<=0 || (int64u)(size_t)Stat.st_size!=(int64u)Stat.st_size)
+        {
+            close(File);
+            return false; //Empty file or not addressable
+        }
+        //Read only, parsers never modify the buffer
+        //If the file is truncated by another process while mapped, reading the removed part raises SIGBUS, not handled here; this is why memory mapping is opt-in (File_MMap)
+        void* View=mmap(NULL, (size_t)Stat.st_size, PROT_READ, MAP_PRIVATE, File, 0);
+        close(File); //The mapping keeps the file
+        if (View==MAP_FAILED)
+            return false;
+        MMap_Size=(int64u)Stat.st_size;
+    #endif //WINDOWS
+
+    MMap_Buffer=(int8u*)View;
+    return true;
+}
+
+//---------------------------------------------------------------------------
+void Reader_File::MMap_Close(MediaInfo_Internal* MI)
+{
+    if (!MMap_Buffer)
+        return;
+
+    if (MI && MI->Config.File_Buffer>=MMap_Buffer && MI->Config.File_Buffer<=MMap_Buffer+MMap_Size)
+    {
+        //File buffer is a view of the mapping
+        MI->Config.File_Buffer=NULL;
+        MI->Config.File_Buffer_Size=0;
+        MI->Config.File_Buffer_Size_Max=0;
+    }
+
+    #ifdef WINDOWS
+        UnmapViewOfFile(MMap_Buffer);
+    #else //WINDOWS
+        munmap(MMap_Buffer, (size_t)MMap_Size);
+    #endif //WINDOWS
+    MMap_Buffer=NULL;
+    MMap_Size=0;
+}
+#endif //MEDIAINFO_MMAP
+
 //---------------------------------------------------------------------------
 size_t Reader_File::Format_Test(MediaInfo_Internal* MI, String File_Name)
 {
@@ -232,11 +560,27 @@ size_t Reader_File::Format_Test_PerParser(MediaInfo_Internal* MI, const String &
         ThreadInstance=NULL;
         Buffer_End2=0; //Is also used for counting bytes before activating the thread
     #endif //MEDIAINFO_READTHREAD
+    #if MEDIAINFO_PREFETCH
+        Destroy_Prefetch();
+        Prefetch_FileName=File_Name;
+        MI->Config.File_Prefetch_Hints.clear();
+    #endif //MEDIAINFO_PREFETCH
+    #if MEDIAINFO_MMAP
+        MMap_Close(MI);
+    #endif //MEDIAINFO_MMAP
 
     //Opening the file
     F.Open(File_Name);
     if (!F.Opened_Get())
         return 0;
+    #if MEDIAINFO_MMAP
+        if (MI->Config.File_MMap_Get() && MI->Config.File_Names.size()<=1 && !MI->Config.File_GrowingFile_Force_Get() && MMap_Open(File_Name)) //On failure, normal reads are used
+        {
+            #if MEDIAINFO_READTHREAD
+                Buffer_End2=(size_t)-1; //No read thread on mapped data
+            #endif //MEDIAINFO_READTHREAD
+        }
+    #endif //MEDIAINFO_MMAP
 
     //Info
     Status=0;
@@ -383,6 +727,12 @@ size_t Reader_File::Format_Test_PerParser_Continue (MediaInfo_Internal* MI)
         //Test the format with buffer
         while (!(Status[File__Analyze::IsFinished] || (StopAfterFilled && Status[File__Analyze::IsFilled])))
         {
+            #if MEDIAINFO_PREFETCH
+                //Requesting data the parser will jump to later
+                if (!MI->Config.File_Prefetch_Hints.empty())
+                    Prefetch_Dispatch(MI);
+            #endif //MEDIAINFO_PREFETCH
+
             //Seek (if needed)
             if (MI->Open_Buffer_Continue_GoTo_Get()!=(int64u)-1)
             {
@@ -454,10 +804,22 @@ size_t Reader_File::Format_Test_PerParser_Continue (MediaInfo_Internal* MI)
                     break; //Seek requested, but on a file bigger in theory than what is in the real file, we can't do this
                 if (!(GoTo>F.Position_Get() && GoTo<F.Position_Get()+Buffer_NoJump_Temp)) //No smal jumps
                 {
-                     if (!F.GoTo(GoTo))
-                        break; //File is not seekable
+                    #if MEDIAINFO_PREFETCH
+                        if (Prefetch_Take(MI, GoTo))
+                            MI->Open_Buffer_Init((int64u)-1, MI->Config.File_Current_Offset+GoTo-Partial_Begin); //File position is after the prefetched data
+                        else
+                    #endif //MEDIAINFO_PREFETCH
+                    {
+                        if (!F.GoTo(GoTo))
+                            break; //File is not seekable
+
+                        MI->Open_Buffer_Init((int64u)-1, MI->Config.File_Current_Offset+F.Position_Get()-Partial_Begin);
+                    }
 
-                    MI->Open_Buffer_Init((int64u)-1, MI->Config.File_Current_Offset+F.Position_Get()-Partial_Begin);
+                    #if MEDIAINFO_ADVANCED
+                        if (MI->Info && MI->Info->Profile_IsActive)
+                            MI->Info->Profile_Seeks++; //Counted once, when the seek is really done
+                    #endif //MEDIAINFO_ADVANCED
                 }
             }
 
@@ -494,6 +856,9 @@ size_t Reader_File::Format_Test_PerParser_Continue (MediaInfo_Internal* MI)
                 #if MEDIAINFO_READTHREAD
                     ThreadInstance==NULL &&
                 #endif //MEDIAINFO_READTHREAD
+                #if MEDIAINFO_MMAP
+                    MMap_Buffer==NULL &&
+                #endif //MEDIAINFO_MMAP
                 MI->Config.File_Buffer_Size_ToRead>MI->Config.File_Buffer_Size_Max)
             {
                 delete[] MI->Config.File_Buffer;
@@ -552,6 +917,18 @@ size_t Reader_File::Format_Test_PerParser_Continue (MediaInfo_Internal* MI)
                 }
             }
 
+            #if MEDIAINFO_PREFETCH
+                if (Prefetch_Current)
+                {
+                    //Prefetched data becomes the file buffer
+                    delete[] MI->Config.File_Buffer;
+                    MI->Config.File_Buffer=Prefetch_Current->Buffer;
+                    MI->Config.File_Buffer_Size_Max=Prefetch_Current->Buffer_Max;
+                    MI->Config.File_Buffer_Size=Prefetch_Current->Buffer_Size;
+                    delete Prefetch_Current; Prefetch_Current=NULL;
+                }
+                else
+            #endif //MEDIAINFO_PREFETCH
             #if MEDIAINFO_READTHREAD
                 if (ThreadInstance)
                 {
@@ -611,6 +988,27 @@ size_t Reader_File::Format_Test_PerParser_Continue (MediaInfo_Internal* MI)
                     if (SizeToRead>SizeToRead_Max)
                         SizeToRead=SizeToRead_Max;
                 }
+                #if MEDIAINFO_MMAP
+                    if (MMap_Buffer && (F.Position_Get()+SizeToRead>MMap_Size || MI->Config.File_Names.size()>1))
+                    {
+                        //File changed since it was mapped, back to normal reads
+                        MMap_Close(MI);
+                        MI->Config.File_Buffer_Size_Max=SizeToRead?SizeToRead:1;
+                        MI->Config.File_Buffer=new int8u[MI->Config.File_Buffer_Size_Max];
+                    }
+                    if (MMap_Buffer)
+                    {
+                        //View of the mapped file, no copy
+                        if (MI->Config.File_Buffer_Size_Max)
+                        {
+                            delete[] MI->Config.File_Buffer;
+                            MI->Config.File_Buffer_Size_Max=0;
+                        }
+                        MI->Config.File_Buffer=MMap_Buffer+F.Position_Get();
+                        MI->Config.File_Buffer_Size=F.GoTo(F.Position_Get()+SizeToRead)?SizeToRead:0;
+                    }
+                    else
+                #endif //MEDIAINFO_MMAP
                 MI->Config.File_Buffer_Size=F.Read(MI->Config.File_Buffer, SizeToRead);
                 #if MEDIAINFO_READTHREAD
                     if (ThreadInstance==NULL && Buffer_End2!=(size_t)-1)
@@ -802,9 +1200,15 @@ size_t Reader_File::Format_Test_PerParser_Continue (MediaInfo_Internal* MI)
         else
     #endif //MEDIAINFO_READTHREAD
     {
+        #if MEDIAINFO_MMAP
+            MMap_Close(MI);
+        #endif //MEDIAINFO_MMAP
         delete[] MI->Config.File_Buffer; MI->Config.File_Buffer=NULL;
         MI->Config.File_Buffer_Size_Max=0;
     }
+    #if MEDIAINFO_PREFETCH
+        Destroy_Prefetch();
+    #endif //MEDIAINFO_PREFETCH
 
     #ifdef MEDIAINFO_DEBUG
         std::cout<<std::hex<<Reader_File_Offset<<" - "<<Reader_File_Offset+Reader_File_BytesRead<<" : "<<std::dec<<Reader_File_BytesRead<<" bytes"<<std::endl;
@@ -22,6 +22,10 @@
 #include "ZenLib/File.h"
 #include "ZenLib/Thread.h"
 #include "ZenLib/CriticalSection.h"
+#if MEDIAINFO_PREFETCH
+    #include <condition_variable>
+    #include <mutex>
+#endif //MEDIAINFO_PREFETCH
 #if MEDIAINFO_READTHREAD
     #ifdef WINDOWS
         #undef __TEXT
@@ -48,10 +52,22 @@ public:
 };
 #endif //MEDIAINFO_READTHREAD
 
+#if MEDIAINFO_PREFETCH
+class Reader_File;
+class Reader_File_Prefetch : public Thread
+{
+public:
+    Reader_File* Base;
+    ZenLib::File F; //Each thread has its own handle, so several reads are in flight
+    void Entry();
+};
+#endif //MEDIAINFO_PREFETCH
+
 class Reader_File : public Reader__Base
 {
 public :
     //Constructor/Destructor
+    Reader_File();
     virtual ~Reader_File();
 
     //Format testing
@@ -83,6 +99,41 @@ private:
     void Destroy_Thread(MediaInfo_Internal* MI);
 public:
     #endif //MEDIAINFO_READTHREAD
+
+    //Prefetch
+    #if MEDIAINFO_PREFETCH
+        struct prefetch
+        {
+            int64u Offset;
+            int8u* Buffer;
+            size_t Buffer_Max;
+            size_t Buffer_Size;
+            bool   IsStarted;
+            bool   IsDone;
+        };
+        std::vector<prefetch*> Prefetch_Items;
+        std::vector<Reader_File_Prefetch*> Prefetch_Threads;
+        prefetch* Prefetch_Current;
+        String Prefetch_FileName;
+        std::mutex Prefetch_Mutex; //Protects Prefetch_Items content and Prefetch_Running
+        std::condition_variable Prefetch_Condition; //Signaled when an item is read or when a thread exits
+        size_t Prefetch_Running;
+private:
+    void Prefetch_Dispatch(MediaInfo_Internal* MI);
+    bool Prefetch_Take(MediaInfo_Internal* MI, int64u GoTo);
+    void Destroy_Prefetch();
+public:
+    #endif //MEDIAINFO_PREFETCH
+
+    //Memory mapping, read only (buffer is never modified), file must not be truncated during parsing (SIGBUS on POSIX systems)
+    #if MEDIAINFO_MMAP
+        int8u* MMap_Buffer;
+        int64u MMap_Size;
+private:
+    bool MMap_Open(const String &File_Name);
+    void MMap_Close(MediaInfo_Internal* MI);
+public:
+    #endif //MEDIAINFO_MMAP
     CriticalSection CS;
     MediaInfo_Internal* MI_Internal;
 };
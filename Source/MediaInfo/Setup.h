@@ -116,6 +116,12 @@
     #if !defined (MEDIAINFO_READTHREAD_NO) && !defined (MEDIAINFO_READTHREAD_YES)
         #define MEDIAINFO_READTHREAD_NO
     #endif
+    #if !defined (MEDIAINFO_PREFETCH_NO) && !defined (MEDIAINFO_PREFETCH_YES)
+        #define MEDIAINFO_PREFETCH_NO
+    #endif
+    #if !defined (MEDIAINFO_MMAP_NO) && !defined (MEDIAINFO_MMAP_YES)
+        #define MEDIAINFO_MMAP_NO
+    #endif
     #if !defined (MEDIAINFO_MD5_NO) && !defined (MEDIAINFO_MD5_YES)
         #define MEDIAINFO_MD5_NO
     #endif
@@ -125,6 +131,27 @@
     #if !defined (MEDIAINFO_SHA2_NO) && !defined (MEDIAINFO_SHA2_YES)
         #define MEDIAINFO_SHA2_NO
     #endif
+    #if !defined (MEDIAINFO_XXH3_NO) && !defined (MEDIAINFO_XXH3_YES)
+        #define MEDIAINFO_XXH3_NO
+    #endif
+    #if !defined (MEDIAINFO_CRC64_NO) && !defined (MEDIAINFO_CRC64_YES)
+        #define MEDIAINFO_CRC64_NO
+    #endif
+    #if !defined (MEDIAINFO_HASH_THREAD_NO) && !defined (MEDIAINFO_HASH_THREAD_YES)
+        #define MEDIAINFO_HASH_THREAD_NO
+    #endif
+    #if !defined (MEDIAINFO_REFERENCES_THREAD_NO) && !defined (MEDIAINFO_REFERENCES_THREAD_YES)
+        #define MEDIAINFO_REFERENCES_THREAD_NO
+    #endif
+    #if !defined (MEDIAINFO_BINARY_NO) && !defined (MEDIAINFO_BINARY_YES)
+        #define MEDIAINFO_BINARY_NO
+    #endif
+    #if !defined (MEDIAINFO_CACHE_NO) && !defined (MEDIAINFO_CACHE_YES)
+        #define MEDIAINFO_CACHE_NO
+    #endif
+    #if !defined (MEDIAINFO_EVENTS_ASYNC_NO) && !defined (MEDIAINFO_EVENTS_ASYNC_YES)
+        #define MEDIAINFO_EVENTS_ASYNC_NO
+    #endif
     #if !defined (MEDIAINFO_AES_NO) && !defined (MEDIAINFO_AES_YES)
         #define MEDIAINFO_AES_NO
     #endif
@@ -291,6 +318,76 @@
         #define MEDIAINFO_SHA2 1
     #endif
 #endif
+#if !defined(MEDIAINFO_XXH3)
+    #if defined(MEDIAINFO_XXH3_NO) && defined(MEDIAINFO_XXH3_YES)
+        #undef MEDIAINFO_XXH3_NO //MEDIAINFO_XXH3_YES has priority
+    #endif
+    #if defined(MEDIAINFO_XXH3_NO)
+        #define MEDIAINFO_XXH3 0
+    #else
+        #define MEDIAINFO_XXH3 1
+    #endif
+#endif
+#if !defined(MEDIAINFO_CRC64)
+    #if defined(MEDIAINFO_CRC64_NO) && defined(MEDIAINFO_CRC64_YES)
+        #undef MEDIAINFO_CRC64_NO //MEDIAINFO_CRC64_YES has priority
+    #endif
+    #if defined(MEDIAINFO_CRC64_NO)
+        #define MEDIAINFO_CRC64 0
+    #else
+        #define MEDIAINFO_CRC64 1
+    #endif
+#endif
+#if !defined(MEDIAINFO_HASH_THREAD)
+    #if defined(MEDIAINFO_HASH_THREAD_NO) && defined(MEDIAINFO_HASH_THREAD_YES)
+        #undef MEDIAINFO_HASH_THREAD_NO //MEDIAINFO_HASH_THREAD_YES has priority
+    #endif
+    #if defined(MEDIAINFO_HASH_THREAD_NO)
+        #define MEDIAINFO_HASH_THREAD 0
+    #else
+        #define MEDIAINFO_HASH_THREAD 1
+    #endif
+#endif
+#if !defined(MEDIAINFO_REFERENCES_THREAD)
+    #if defined(MEDIAINFO_REFERENCES_THREAD_NO) && defined(MEDIAINFO_REFERENCES_THREAD_YES)
+        #undef MEDIAINFO_REFERENCES_THREAD_NO //MEDIAINFO_REFERENCES_THREAD_YES has priority
+    #endif
+    #if defined(MEDIAINFO_REFERENCES_THREAD_NO)
+        #define MEDIAINFO_REFERENCES_THREAD 0
+    #else
+        #define MEDIAINFO_REFERENCES_THREAD 1
+    #endif
+#endif
+#if !defined(MEDIAINFO_BINARY)
+    #if defined(MEDIAINFO_BINARY_NO) && defined(MEDIAINFO_BINARY_YES)
+        #undef MEDIAINFO_BINARY_NO //MEDIAINFO_BINARY_YES has priority
+    #endif
+    #if defined(MEDIAINFO_BINARY_NO)
+        #define MEDIAINFO_BINARY 0
+    #else
+        #define MEDIAINFO_BINARY 1
+    #endif
+#endif
+#if !defined(MEDIAINFO_CACHE)
+    #if defined(MEDIAINFO_CACHE_NO) && defined(MEDIAINFO_CACHE_YES)
+        #undef MEDIAINFO_CACHE_NO //MEDIAINFO_CACHE_YES has priority
+    #endif
+    #if defined(MEDIAINFO_CACHE_NO) || !MEDIAINFO_BINARY //Cache files use the binary format
+        #define MEDIAINFO_CACHE 0
+    #else
+        #define MEDIAINFO_CACHE 1
+    #endif
+#endif
+#if !defined(MEDIAINFO_EVENTS_ASYNC)
+    #if defined(MEDIAINFO_EVENTS_ASYNC_NO) && defined(MEDIAINFO_EVENTS_ASYNC_YES)
+        #undef MEDIAINFO_EVENTS_ASYNC_NO //MEDIAINFO_EVENTS_ASYNC_YES has priority
+    #endif
+    #if defined(MEDIAINFO_EVENTS_ASYNC_NO) || !MEDIAINFO_EVENTS
+        #define MEDIAINFO_EVENTS_ASYNC 0
+    #else
+        #define MEDIAINFO_EVENTS_ASYNC 1
+    #endif
+#endif
 #if !defined(MEDIAINFO_COMPRESS)
     #if defined(MEDIAINFO_COMPRESS_NO) && defined(MEDIAINFO_COMPRESS_YES)
         #undef MEDIAINFO_COMPRESS_NO //MEDIAINFO_COMPRESS_YES has priority
@@ -378,6 +475,26 @@
         #endif //MEDIAINFO_ADVANCED
     #endif
 #endif
+#if !defined(MEDIAINFO_PREFETCH)
+    #if defined(MEDIAINFO_PREFETCH_NO) && defined(MEDIAINFO_PREFETCH_YES)
+        #undef MEDIAINFO_PREFETCH_NO //MEDIAINFO_PREFETCH_YES has priority
+    #endif
+    #if defined(MEDIAINFO_PREFETCH_NO)
+        #define MEDIAINFO_PREFETCH 0
+    #else
+        #define MEDIAINFO_PREFETCH 1
+    #endif
+#endif
+#if !defined(MEDIAINFO_MMAP)
+    #if defined(MEDIAINFO_MMAP_NO) && defined(MEDIAINFO_MMAP_YES)
+        #undef MEDIAINFO_MMAP_NO //MEDIAINFO_MMAP_YES has priority
+    #endif
+    #if defined(MEDIAINFO_MMAP_NO)
+        #define MEDIAINFO_MMAP 0
+    #else
+        #define MEDIAINFO_MMAP 1
+    #endif
+#endif
 
 //***************************************************************************
 // Precise configuration
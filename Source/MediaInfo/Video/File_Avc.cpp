@@ -1322,16 +1322,8 @@ bool File_Avc::Synchronize()
 {
     //Synchronizing
     size_t Buffer_Offset_Min=Buffer_Offset;
-    while(Buffer_Offset+4<=Buffer_Size && (Buffer[Buffer_Offset  ]!=0x00
-                                        || Buffer[Buffer_Offset+1]!=0x00
-                                        || Buffer[Buffer_Offset+2]!=0x01))
-    {
-        Buffer_Offset+=2;
-        while(Buffer_Offset<Buffer_Size && Buffer[Buffer_Offset]!=0x00)
-            Buffer_Offset+=2;
-        if (Buffer_Offset>=Buffer_Size || Buffer[Buffer_Offset-1]==0x00)
-            Buffer_Offset--;
-    }
+    if (Buffer_Offset+4<=Buffer_Size)
+        Buffer_Offset=Find_StartCode(Buffer, Buffer_Offset, Buffer_Size-1);
     if (Buffer_Offset>Buffer_Offset_Min && Buffer[Buffer_Offset-1]==0x00)
         Buffer_Offset--;
 
@@ -1954,15 +1946,8 @@ bool File_Avc::Header_Parser_Fill_Size()
     //Look for next Sync word
     if (Buffer_Offset_Temp==0) //Buffer_Offset_Temp is not 0 if Header_Parse_Fill_Size() has already parsed first frames
         Buffer_Offset_Temp=Buffer_Offset+4;
-    while (Buffer_Offset_Temp+5<=Buffer_Size
-        && CC3(Buffer+Buffer_Offset_Temp)!=0x000001)
-    {
-        Buffer_Offset_Temp+=2;
-        while(Buffer_Offset_Temp<Buffer_Size && Buffer[Buffer_Offset_Temp]!=0x00)
-            Buffer_Offset_Temp+=2;
-        if (Buffer_Offset_Temp>=Buffer_Size || Buffer[Buffer_Offset_Temp-1]==0x00)
-            Buffer_Offset_Temp--;
-    }
+    if (Buffer_Offset_Temp+5<=Buffer_Size)
+        Buffer_Offset_Temp=Find_StartCode(Buffer, Buffer_Offset_Temp, Buffer_Size-2);
 
     //Must wait more data?
     if (Buffer_Offset_Temp+5>Buffer_Size)
@@ -1061,6 +1061,64 @@ const File__Analyze::vlc Mpegv_coded_block_pattern[]=
     VLC_END
 };
 
+//---------------------------------------------------------------------------
+// Lookup tables, built once and shared read-only by all instances
+static File__Analyze::vlc_fast macroblock_address_increment_Vlc;
+static File__Analyze::vlc_fast dct_dc_size_luminance;
+static File__Analyze::vlc_fast dct_dc_size_chrominance;
+static File__Analyze::vlc_fast dct_coefficients_0;
+static File__Analyze::vlc_fast dct_coefficients_1;
+static File__Analyze::vlc_fast macroblock_type_I;
+static File__Analyze::vlc_fast macroblock_type_P;
+static File__Analyze::vlc_fast macroblock_type_B;
+static File__Analyze::vlc_fast motion_code;
+static File__Analyze::vlc_fast dmvector;
+static File__Analyze::vlc_fast coded_block_pattern;
+
+static bool Mpegv_Vlc_Prepare_Once()
+{
+    macroblock_address_increment_Vlc.Vlc=Mpegv_macroblock_address_increment;
+    macroblock_address_increment_Vlc.Size=11;
+    File__Analyze::Get_VL_Prepare(macroblock_address_increment_Vlc);
+    dct_dc_size_luminance.Vlc=Mpegv_dct_dc_size_luminance;
+    dct_dc_size_luminance.Size=9;
+    File__Analyze::Get_VL_Prepare(dct_dc_size_luminance);
+    dct_dc_size_chrominance.Vlc=Mpegv_dct_dc_size_chrominance;
+    dct_dc_size_chrominance.Size=10;
+    File__Analyze::Get_VL_Prepare(dct_dc_size_chrominance);
+    dct_coefficients_0.Vlc=Mpegv_dct_coefficients_0;
+    dct_coefficients_0.Size=17;
+    File__Analyze::Get_VL_Prepare(dct_coefficients_0);
+    dct_coefficients_1.Vlc=Mpegv_dct_coefficients_1;
+    dct_coefficients_1.Size=17;
+    File__Analyze::Get_VL_Prepare(dct_coefficients_1);
+    macroblock_type_I.Vlc=Mpegv_macroblock_type_I;
+    macroblock_type_I.Size=2;
+    File__Analyze::Get_VL_Prepare(macroblock_type_I);
+    macroblock_type_P.Vlc=Mpegv_macroblock_type_P;
+    macroblock_type_P.Size=6;
+    File__Analyze::Get_VL_Prepare(macroblock_type_P);
+    macroblock_type_B.Vlc=Mpegv_macroblock_type_B;
+    macroblock_type_B.Size=6;
+    File__Analyze::Get_VL_Prepare(macroblock_type_B);
+    motion_code.Vlc=Mpegv_motion_code;
+    motion_code.Size=11;
+    File__Analyze::Get_VL_Prepare(motion_code);
+    dmvector.Vlc=Mpegv_dmvector;
+    dmvector.Size=2;
+    File__Analyze::Get_VL_Prepare(dmvector);
+    coded_block_pattern.Vlc=Mpegv_coded_block_pattern;
+    coded_block_pattern.Size=9;
+    File__Analyze::Get_VL_Prepare(coded_block_pattern);
+    return true;
+}
+
+static void Mpegv_Vlc_Prepare()
+{
+    static const bool Prepared=Mpegv_Vlc_Prepare_Once(); //Thread-safe initialization of local statics
+    (void)Prepared;
+}
+
 #endif //MEDIAINFO_MACROBLOCKS
 
 #if !MEDIAINFO_ADVANCED
@@ -1170,23 +1228,6 @@ File_Mpegv::~File_Mpegv()
         delete DTG1_Parser; //DTG1_Parser=NULL;
         delete GA94_06_Parser; //GA94_06_Parser=NULL;
     #endif //defined(MEDIAINFO_AFDBARDATA_YES)
-
-    //Macroblocks
-    #if MEDIAINFO_MACROBLOCKS
-        if (Macroblocks_Parse)
-        {
-            delete[] macroblock_address_increment_Vlc.Array; //macroblock_address_increment_Vlc.Array=NULL;
-            delete[] macroblock_address_increment_Vlc.BitsToSkip; //macroblock_address_increment_Vlc.Size=NULL;
-            delete[] dct_dc_size_luminance.Array; //dct_dc_size_luminance.Array=NULL;
-            delete[] dct_dc_size_luminance.BitsToSkip; //dct_dc_size_luminance.Size=NULL;
-            delete[] dct_dc_size_chrominance.Array; //dct_dc_size_chrominance.Array=NULL;
-            delete[] dct_dc_size_chrominance.BitsToSkip; //dct_dc_size_chrominance.Size=NULL;
-            delete[] dct_coefficients_0.Array; //dct_coefficients_0.Array=NULL;
-            delete[] dct_coefficients_0.BitsToSkip; //dct_coefficients_0.Size=NULL;
-            delete[] dct_coefficients_1.Array; //dct_coefficients_1.Array=NULL;
-            delete[] dct_coefficients_1.BitsToSkip; //dct_coefficients_1.Size=NULL;
-        }
-    #endif //MEDIAINFO_MACROBLOCKS
 }
 
 //***************************************************************************
@@ -1851,52 +1892,7 @@ void File_Mpegv::Synched_Init()
     #if MEDIAINFO_MACROBLOCKS
         Macroblocks_Parse=Config->File_Macroblocks_Parse_Get();
         if (Macroblocks_Parse)
-        {
-            macroblock_address_increment_Vlc.Array=NULL;
-            macroblock_address_increment_Vlc.Vlc=Mpegv_macroblock_address_increment;
-            macroblock_address_increment_Vlc.Size=11;
-            Get_VL_Prepare(macroblock_address_increment_Vlc);
-            dct_dc_size_luminance.Array=NULL;
-            dct_dc_size_luminance.Vlc=Mpegv_dct_dc_size_luminance;
-            dct_dc_size_luminance.Size=9;
-            Get_VL_Prepare(dct_dc_size_luminance);
-            dct_dc_size_chrominance.Array=NULL;
-            dct_dc_size_chrominance.Vlc=Mpegv_dct_dc_size_chrominance;
-            dct_dc_size_chrominance.Size=10;
-            Get_VL_Prepare(dct_dc_size_chrominance);
-            dct_coefficients_0.Array=NULL;
-            dct_coefficients_0.Vlc=Mpegv_dct_coefficients_0;
-            dct_coefficients_0.Size=17;
-            Get_VL_Prepare(dct_coefficients_0);
-            dct_coefficients_1.Array=NULL;
-            dct_coefficients_1.Vlc=Mpegv_dct_coefficients_1;
-            dct_coefficients_1.Size=17;
-            Get_VL_Prepare(dct_coefficients_1);
-            macroblock_type_I.Array=NULL;
-            macroblock_type_I.Vlc=Mpegv_macroblock_type_I;
-            macroblock_type_I.Size=2;
-            Get_VL_Prepare(macroblock_type_I);
-            macroblock_type_P.Array=NULL;
-            macroblock_type_P.Vlc=Mpegv_macroblock_type_P;
-            macroblock_type_P.Size=6;
-            Get_VL_Prepare(macroblock_type_P);
-            macroblock_type_B.Array=NULL;
-            macroblock_type_B.Vlc=Mpegv_macroblock_type_B;
-            macroblock_type_B.Size=6;
-            Get_VL_Prepare(macroblock_type_B);
-            motion_code.Array=NULL;
-            motion_code.Vlc=Mpegv_motion_code;
-            motion_code.Size=11;
-            Get_VL_Prepare(motion_code);
-            dmvector.Array=NULL;
-            dmvector.Vlc=Mpegv_dmvector;
-            dmvector.Size=2;
-            Get_VL_Prepare(dmvector);
-            coded_block_pattern.Array=NULL;
-            coded_block_pattern.Vlc=Mpegv_coded_block_pattern;
-            coded_block_pattern.Size=9;
-            Get_VL_Prepare(coded_block_pattern);
-        }
+            Mpegv_Vlc_Prepare();
     #endif //MEDIAINFO_MACROBLOCKS
 }
 
@@ -2120,15 +2116,8 @@ bool File_Mpegv::Header_Parser_Fill_Size()
     //Look for next Sync word
     if (Buffer_Offset_Temp==0) //Buffer_Offset_Temp is not 0 if Header_Parse_Fill_Size() has already parsed first frames
         Buffer_Offset_Temp=Buffer_Offset+4;
-    while (Buffer_Offset_Temp+4<=Buffer_Size
-        && CC3(Buffer+Buffer_Offset_Temp)!=0x000001)
-    {
-        Buffer_Offset_Temp+=2;
-        while(Buffer_Offset_Temp<Buffer_Size && Buffer[Buffer_Offset_Temp]!=0x00)
-            Buffer_Offset_Temp+=2;
-        if (Buffer_Offset_Temp>=Buffer_Size || Buffer[Buffer_Offset_Temp-1]==0x00)
-            Buffer_Offset_Temp--;
-    }
+    if (Buffer_Offset_Temp+4<=Buffer_Size)
+        Buffer_Offset_Temp=Find_StartCode(Buffer, Buffer_Offset_Temp, Buffer_Size-1);
 
     //Must wait more data?
     if (Buffer_Offset_Temp+4>Buffer_Size)
@@ -2841,7 +2830,7 @@ void File_Mpegv::slice_start_macroblock()
         macroblock_x=0;
     Element_Info1(__T("macroblock_x=")+Ztring::ToZtring(macroblock_x));
     Element_Trace_Begin1("macroblock_modes");
-        vlc_fast* macroblock_type_X;
+        const vlc_fast* macroblock_type_X;
         switch(picture_coding_type)
         {
             case 1: macroblock_type_X=&macroblock_type_I; break;
@@ -3052,7 +3041,7 @@ void File_Mpegv::slice_start_macroblock_block(int8u i)
     Element_Trace_Begin1("block"); Element_Info1(i);
     bool IsFirst;
     const vlc* Mpegv_dct_coefficients;
-    vlc_fast* Mpegv_dct_coefficients2;
+    const vlc_fast* Mpegv_dct_coefficients2;
     if (macroblock_type&macroblock_intra)
     {
         IsFirst=false;
@@ -306,17 +306,6 @@ private :
         bool    frame_pred_frame_dct;
         bool    concealment_motion_vectors;
         bool    intra_vlc_format;
-        vlc_fast macroblock_address_increment_Vlc;
-        vlc_fast dct_dc_size_luminance;
-        vlc_fast dct_dc_size_chrominance;
-        vlc_fast dct_coefficients_0;
-        vlc_fast dct_coefficients_1;
-        vlc_fast macroblock_type_I;
-        vlc_fast macroblock_type_P;
-        vlc_fast macroblock_type_B;
-        vlc_fast motion_code;
-        vlc_fast dmvector;
-        vlc_fast coded_block_pattern;
     #endif //MEDIAINFO_MACROBLOCKS
 
     #if MEDIAINFO_IBIUSAGE
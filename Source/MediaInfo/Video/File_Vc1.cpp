@@ -163,6 +163,24 @@ const File__Analyze::vlc Vc1_ptype[]=
     VLC_END
 };
 
+//---------------------------------------------------------------------------
+// Lookup table, built once and shared read-only by all instances
+static File__Analyze::vlc_fast Vc1_ptype_Vlc;
+
+static bool Vc1_Vlc_Prepare_Once()
+{
+    Vc1_ptype_Vlc.Vlc=Vc1_ptype;
+    Vc1_ptype_Vlc.Size=4;
+    File__Analyze::Get_VL_Prepare(Vc1_ptype_Vlc);
+    return true;
+}
+
+static void Vc1_Vlc_Prepare()
+{
+    static const bool Prepared=Vc1_Vlc_Prepare_Once(); //Thread-safe initialization of local statics
+    (void)Prepared;
+}
+
 //---------------------------------------------------------------------------
 /*
 static int32u Vc1_bfraction(int8u Size, int32u Value)
@@ -238,6 +256,7 @@ File_Vc1::File_Vc1()
     EntryPoint_Parsed=false;
     FrameRate=0;
     RefFramesCount=0;
+    Vc1_Vlc_Prepare();
 
     #if MEDIAINFO_DEMUX
         InitData_Buffer=NULL;
@@ -811,7 +830,7 @@ void File_Vc1::FrameHeader()
         else
         {
             size_t ptype_;
-            Get_VL (Vc1_ptype, ptype_,                          "ptype"); if (ptype_<5) {Param_Info1(Vc1_Type[Vc1_ptype[ptype_].mapped_to3]); Element_Info1(Vc1_Type[Vc1_ptype[ptype_].mapped_to3]);}
+            Get_VL (Vc1_ptype_Vlc, ptype_,                      "ptype"); if (ptype_<5) {Param_Info1(Vc1_Type[Vc1_ptype[ptype_].mapped_to3]); Element_Info1(Vc1_Type[Vc1_ptype[ptype_].mapped_to3]);}
             ptype=(int8u)Vc1_ptype[ptype_].mapped_to3;
         }
         if (RefFramesCount<2 && (ptype==0 || ptype==1))
@@ -18,6 +18,7 @@ import java.net.URL;
 
 import com.sun.jna.FunctionMapper;
 import com.sun.jna.Library;
+import com.sun.jna.Memory;
 import com.sun.jna.Native;
 import com.sun.jna.NativeLibrary;
 import com.sun.jna.Pointer;
@@ -119,6 +120,7 @@ class MediaInfo
         WString Get(Pointer Handle, int StreamKind, SizeT StreamNumber, WString parameter, int infoKind, int searchKind);
         WString GetI(Pointer Handle, int StreamKind, SizeT StreamNumber, SizeT parameterIndex, int infoKind);
         SizeT   Count_Get(Pointer Handle, int StreamKind, SizeT StreamNumber);
+        SizeT   Get_Batch(Pointer Handle, SizeT Count, int[] StreamKinds, Pointer StreamNumbers, WString[] parameters, int infoKind, Pointer[] results);
 
         //Options
         WString Option(Pointer Handle, WString option, WString value);
@@ -330,6 +332,44 @@ class MediaInfo
     }
 
 
+    /**
+     * Get several pieces of information about a file in one call (parameters are strings).
+     *
+     * @param StreamKinds Kind of Stream of each request
+     * @param StreamNumbers Stream number of each request
+     * @param parameters Parameter of each request, in string format ("Codec", "Width"...)
+     * @param infoKind Kind of information you want about the parameters (the text, the measure,
+     *            the help...)
+     * @return a string per request, an empty string if there is a problem
+     */
+    public String[] Get_Batch(StreamKind[] StreamKinds, int[] StreamNumbers, String[] parameters, InfoKind infoKind)
+    {
+        int Count = parameters.length;
+        String[] ToReturn = new String[Count];
+        if (Count == 0)
+            return ToReturn;
+
+        int[] StreamKinds_Temp = new int[Count];
+        Memory StreamNumbers_Temp = new Memory((long)Count * Native.SIZE_T_SIZE);
+        WString[] parameters_Temp = new WString[Count];
+        for (int Pos = 0; Pos < Count; Pos++)
+        {
+            StreamKinds_Temp[Pos] = StreamKinds[Pos].ordinal();
+            if (Native.SIZE_T_SIZE == 8)
+                StreamNumbers_Temp.setLong((long)Pos * 8, StreamNumbers[Pos]);
+            else
+                StreamNumbers_Temp.setInt((long)Pos * 4, StreamNumbers[Pos]);
+            parameters_Temp[Pos] = new WString(parameters[Pos]);
+        }
+
+        Pointer[] results = new Pointer[Count];
+        MediaInfoDLL_Internal.INSTANCE.Get_Batch(Handle, new MediaInfoDLL_Internal.SizeT(Count), StreamKinds_Temp, StreamNumbers_Temp, parameters_Temp, infoKind.ordinal(), results);
+        for (int Pos = 0; Pos < Count; Pos++)
+            ToReturn[Pos] = results[Pos] == null ? "" : results[Pos].getWideString(0);
+        return ToReturn;
+    }
+
+
     /**
      * Get a piece of information about a file (parameter is an integer).
      *
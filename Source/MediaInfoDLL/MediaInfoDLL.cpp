@@ -48,6 +48,8 @@ struct mi_output
 {
     std::string  Ansi;    //One-Byte-sized characters
     std::wstring Unicode; //Unicode characters
+    std::vector<std::string>  Ansi_Batch;    //One-Byte-sized characters, one per batch result
+    std::vector<String>       Unicode_Batch; //Unicode characters, one per batch result
 };
 typedef std::map<void*, mi_output*> mi_outputs;
 
@@ -474,6 +476,47 @@ size_t          __stdcall MediaInfoA_Count_Get(void* Handle, MediaInfo_stream_t
     return MediaInfo_Count_Get(Handle, StreamKind, StreamNumber);
 }
 
+size_t          __stdcall MediaInfoA_Get_Batch(void* Handle, size_t Count, const MediaInfo_stream_t* StreamKinds, const size_t* StreamNumbers, const char* const* Parameters, MediaInfo_info_C KindOfInfo, const char** Results)
+{
+    if (!Count || !Parameters || !Results)
+        return 0;
+
+    //Adaptation of input
+    std::vector<Ztring> Parameters_Unicode(Count);
+    std::vector<const wchar_t*> Parameters_Temp(Count);
+    for (size_t Pos=0; Pos<Count; Pos++)
+    {
+        if (!Parameters[Pos])
+            continue;
+        if (utf8)
+            Parameters_Unicode[Pos].From_UTF8(Parameters[Pos]);
+        else
+            Parameters_Unicode[Pos].From_Local(Parameters[Pos]);
+        Parameters_Temp[Pos]=Parameters_Unicode[Pos].c_str();
+    }
+
+    std::vector<const wchar_t*> Results_Temp(Count);
+    size_t ToReturn=MediaInfo_Get_Batch(Handle, Count, StreamKinds, StreamNumbers, &Parameters_Temp[0], KindOfInfo, &Results_Temp[0]);
+    if (ToReturn==(size_t)-1)
+        return ToReturn;
+
+    //Adaptation of output
+    mi_outputs::iterator MI_Output=MI_Outputs_Find(Handle);
+    std::vector<std::string> &Ansi_Batch=MI_Output->second->Ansi_Batch;
+    Ansi_Batch.resize(Count);
+    for (size_t Pos=0; Pos<Count; Pos++)
+    {
+        if (!Results_Temp[Pos])
+            Ansi_Batch[Pos].clear();
+        else if (utf8)
+            Ansi_Batch[Pos]=Ztring(Results_Temp[Pos]).To_UTF8();
+        else
+            Ansi_Batch[Pos]=Ztring(Results_Temp[Pos]).To_Local();
+        Results[Pos]=Ansi_Batch[Pos].c_str();
+    }
+    return ToReturn;
+}
+
 //---------------------------------------------------------------------------
 
 void*           __stdcall MediaInfoListA_New ()
@@ -847,6 +890,39 @@ size_t          __stdcall MediaInfo_Count_Get(void* Handle, MediaInfo_stream_t S
                     Debug+=", StreamKind=";Debug+=Ztring::ToZtring((size_t)StreamKind).To_UTF8();Debug+=", StreamNumber=";Debug+=Ztring::ToZtring((size_t)StreamNumber).To_UTF8();)
 }
 
+size_t          __stdcall MediaInfo_Get_Batch(void* Handle, size_t Count, const MediaInfo_stream_t* StreamKinds, const size_t* StreamNumbers, const wchar_t* const* Parameters, MediaInfo_info_C KindOfInfo, const wchar_t** Results)
+{
+    KindOfInfo=(MediaInfo_info_C)(((size_t)KindOfInfo)&0xFF);
+    INTEGRITY_SIZE_T(   "Get_Batch",
+                        Debug+=", Count=";Debug+=Ztring::ToZtring(Count).To_UTF8();Debug+=", KindOfInfo=";Debug+=Ztring::ToZtring(KindOfInfo).To_UTF8();)
+    if (!Count || !StreamKinds || !StreamNumbers || !Parameters || !Results)
+        return 0;
+
+    //Adaptation of input
+    std::vector<stream_t> StreamKinds_Temp(Count);
+    std::vector<String> Parameters_Temp(Count);
+    for (size_t Pos=0; Pos<Count; Pos++)
+    {
+        StreamKinds_Temp[Pos]=(stream_t)(((size_t)StreamKinds[Pos])&0xFF);
+        if (Parameters[Pos])
+            Parameters_Temp[Pos]=Parameters[Pos];
+    }
+
+    //Results are kept per handle, valid until the next call
+    std::vector<String> &Unicode_Batch=MI_Output->second->Unicode_Batch;
+    Unicode_Batch.clear();
+    Unicode_Batch.resize(Count);
+    size_t ToReturn;
+    try
+    {
+        ToReturn=((MediaInfo*)Handle)->Get(Count, &StreamKinds_Temp[0], StreamNumbers, &Parameters_Temp[0], &Unicode_Batch[0], (info_t)KindOfInfo);
+    } catch (...) {MEDIAINFO_DEBUG2("Get_Batch", Debug+="!!!Exception thrown!!!";) return (size_t)-1;}
+    for (size_t Pos=0; Pos<Count; Pos++)
+        Results[Pos]=Unicode_Batch[Pos].c_str();
+    MEDIAINFO_DEBUG2("Get_Batch", Debug+=", returns ";Debug+=Ztring::ToZtring(ToReturn).To_UTF8();)
+    return ToReturn;
+}
+
 //---------------------------------------------------------------------------
 
 void*           __stdcall MediaInfoList_New ()
@@ -327,6 +327,8 @@ extern "C"
     static MEDIAINFOLIST_State_Get MediaInfoList_State_Get;
     typedef size_t (__stdcall *MEDIAINFO_Count_Get)(void*, MediaInfo_stream_C StreamKind, size_t StreamNumber);
     static MEDIAINFO_Count_Get MediaInfo_Count_Get;
+    typedef size_t (__stdcall *MEDIAINFO_Get_Batch)(void*, size_t Count, const MediaInfo_stream_C* StreamKinds, const size_t* StreamNumbers, const MediaInfo_Char* const* Parameters, MediaInfo_info_C KindOfInfo, const MediaInfo_Char** Results);
+    static MEDIAINFO_Get_Batch MediaInfo_Get_Batch;
     typedef size_t (__stdcall *MEDIAINFOLIST_Count_Get)(void*, size_t, MediaInfo_stream_C StreamKind, size_t StreamNumber);
     static MEDIAINFOLIST_Count_Get MediaInfoList_Count_Get;
     typedef size_t (__stdcall *MEDIAINFO_Count_Get_Files)(void*);
@@ -434,6 +436,9 @@ extern "C"
             return (size_t) - 1;
         }
 
+        /* Load optional methods (not available in older libraries) */
+        MEDIAINFO_ASSIGN(Get_Batch, "Get_Batch")
+
         Module_Count++;
         return (size_t)1;
     }
@@ -476,6 +481,7 @@ extern "C"
 //---------------------------------------------------------------------------
 #include <string>
 #include <sstream>
+#include <vector>
 //---------------------------------------------------------------------------
 
 namespace MediaInfoDLL
@@ -580,6 +586,38 @@ namespace MediaInfoDLL
         String Inform()  {MEDIAINFO_TEST_STRING; return MediaInfo_Inform(Handle, 0);};
         String Get(stream_t StreamKind, size_t StreamNumber, size_t Parameter, info_t InfoKind = Info_Text)  {MEDIAINFO_TEST_STRING; return MediaInfo_GetI(Handle, (MediaInfo_stream_C)StreamKind, StreamNumber, Parameter, (MediaInfo_info_C)InfoKind);};
         String Get(stream_t StreamKind, size_t StreamNumber, const String &Parameter, info_t InfoKind = Info_Text, info_t SearchKind = Info_Name)  {MEDIAINFO_TEST_STRING; return MediaInfo_Get(Handle, (MediaInfo_stream_C)StreamKind, StreamNumber, Parameter.c_str(), (MediaInfo_info_C)InfoKind, (MediaInfo_info_C)SearchKind);};
+        size_t Get(size_t Count, const stream_t* StreamKinds, const size_t* StreamNumbers, const String* Parameters, String* Results, info_t InfoKind = Info_Text)
+        {
+            MEDIAINFO_TEST_INT;
+            if (!Count)
+                return 0;
+            if (!MediaInfo_Get_Batch)
+            {
+                //Older library, one call per field
+                size_t ToReturn = 0;
+                for (size_t Pos = 0; Pos < Count; Pos++)
+                {
+                    Results[Pos] = Get(StreamKinds[Pos], StreamNumbers[Pos], Parameters[Pos], InfoKind);
+                    if (!Results[Pos].empty())
+                        ToReturn++;
+                }
+                return ToReturn;
+            }
+            std::vector<MediaInfo_stream_C> StreamKinds_Temp(Count);
+            std::vector<const MediaInfo_Char*> Parameters_Temp(Count);
+            std::vector<const MediaInfo_Char*> Results_Temp(Count);
+            for (size_t Pos = 0; Pos < Count; Pos++)
+            {
+                StreamKinds_Temp[Pos] = (MediaInfo_stream_C)StreamKinds[Pos];
+                Parameters_Temp[Pos] = Parameters[Pos].c_str();
+            }
+            size_t ToReturn = MediaInfo_Get_Batch(Handle, Count, &StreamKinds_Temp[0], StreamNumbers, &Parameters_Temp[0], (MediaInfo_info_C)InfoKind, &Results_Temp[0]);
+            if (ToReturn == (size_t)-1)
+                return ToReturn;
+            for (size_t Pos = 0; Pos < Count; Pos++)
+                Results[Pos] = Results_Temp[Pos] ? Results_Temp[Pos] : __T("");
+            return ToReturn;
+        }
         //size_t Set (const String &ToSet, stream_t StreamKind, size_t StreamNumber, size_t Parameter, const String &OldValue=__T(""))  {MEDIAINFO_TEST_INT; return MediaInfo_SetI (Handle, ToSet.c_str(), (MediaInfo_stream_C)StreamKind, StreamNumber, Parameter, OldValue.c_str());};
         //size_t Set (const String &ToSet, stream_t StreamKind, size_t StreamNumber, const String &Parameter, const String &OldValue=__T(""))  {MEDIAINFO_TEST_INT; return MediaInfo_Set (Handle, ToSet.c_str(), (MediaInfo_stream_C)StreamKind, StreamNumber, Parameter.c_str(), OldValue.c_str());};
         size_t Output_Buffer_Get(const String &Value) {return MediaInfo_Output_Buffer_Get(Handle, Value.c_str());}
@@ -202,6 +202,18 @@ class MediaInfo:
     MediaInfo_Count_Get.argtypes = [c_void_p, c_size_t, c_size_t]
     MediaInfo_Count_Get.restype = c_size_t
 
+    #/** @brief Wrapper for MediaInfoLib::MediaInfo::Get (batch), Results are valid until the next call with this Handle */
+    #MEDIAINFO_EXP size_t       __stdcall MediaInfo_Get_Batch (void* Handle, size_t Count, const MediaInfo_stream_C* StreamKinds, const size_t* StreamNumbers, const wchar_t* const* Parameters, MediaInfo_info_C InfoKind, const wchar_t** Results); /*Default : InfoKind=Info_Text*/
+    #Not available in older versions of the library, Get_Batch() then falls back to Get()
+    MediaInfo_Get_Batch = getattr(MediaInfoDLL_Handler, "MediaInfo_Get_Batch", None)
+    if MediaInfo_Get_Batch is not None:
+        MediaInfo_Get_Batch.argtypes = [c_void_p, c_size_t, POINTER(c_int), POINTER(c_size_t), POINTER(c_wchar_p), c_size_t, POINTER(c_wchar_p)]
+        MediaInfo_Get_Batch.restype = c_size_t
+    MediaInfoA_Get_Batch = getattr(MediaInfoDLL_Handler, "MediaInfoA_Get_Batch", None)
+    if MediaInfoA_Get_Batch is not None:
+        MediaInfoA_Get_Batch.argtypes = [c_void_p, c_size_t, POINTER(c_int), POINTER(c_size_t), POINTER(c_char_p), c_size_t, POINTER(c_char_p)]
+        MediaInfoA_Get_Batch.restype = c_size_t
+
     Handle = c_void_p(0)
     MustUseAnsi = 0
 
@@ -273,6 +285,27 @@ class MediaInfo:
         return self.MediaInfo_State_Get(self.Handle)
     def Count_Get(self, StreamKind, StreamNumber=-1):
         return self.MediaInfo_Count_Get(self.Handle, StreamKind, StreamNumber)
+    #Requests is a list of (StreamKind, StreamNumber, Parameter), returns a list of strings
+    def Get_Batch(self, Requests, InfoKind=Info.Text):
+        Count = len(Requests)
+        if Count == 0:
+            return []
+        if (self.MediaInfoA_Get_Batch if MustUseAnsi else self.MediaInfo_Get_Batch) is None:
+            return [self.Get(Request[0], Request[1], Request[2], InfoKind) for Request in Requests]
+        StreamKinds = (c_int * Count)(*[int(Request[0]) for Request in Requests])
+        StreamNumbers = (c_size_t * Count)(*[Request[1] for Request in Requests])
+        if MustUseAnsi:
+            Parameters = (c_char_p * Count)(*[Request[2].encode("utf-8") for Request in Requests])
+            Results = (c_char_p * Count)()
+            if self.MediaInfoA_Get_Batch(self.Handle, Count, StreamKinds, StreamNumbers, Parameters, InfoKind, Results) == c_size_t(-1).value:
+                return [""] * Count
+            return [(Result or b"").decode("utf_8", 'ignore') for Result in Results]
+        else:
+            Parameters = (c_wchar_p * Count)(*[Request[2] for Request in Requests])
+            Results = (c_wchar_p * Count)()
+            if self.MediaInfo_Get_Batch(self.Handle, Count, StreamKinds, StreamNumbers, Parameters, InfoKind, Results) == c_size_t(-1).value:
+                return [""] * Count
+            return [Result or "" for Result in Results]
 
 
 class MediaInfoList:
@@ -275,6 +275,8 @@ MEDIAINFO_EXP const wchar_t*    __stdcall MediaInfo_Option (void* Handle, const
 MEDIAINFO_EXP size_t            __stdcall MediaInfo_State_Get (void* Handle);
 /** @brief Wrapper for MediaInfoLib::MediaInfo::Count_Get */
 MEDIAINFO_EXP size_t            __stdcall MediaInfo_Count_Get (void* Handle, MediaInfo_stream_C StreamKind, size_t StreamNumber); /*Default : StreamNumber=-1*/
+/** @brief Wrapper for MediaInfoLib::MediaInfo::Get (batch), Results are valid until the next call with this Handle */
+MEDIAINFO_EXP size_t            __stdcall MediaInfo_Get_Batch (void* Handle, size_t Count, const MediaInfo_stream_C* StreamKinds, const size_t* StreamNumbers, const wchar_t* const* Parameters, MediaInfo_info_C InfoKind, const wchar_t** Results); /*Default : InfoKind=Info_Text*/
 #else //defined(MEDIAINFO_DLL_EXPORT) || (defined(UNICODE) || defined(_UNICODE))
     #define MediaInfo_New               MediaInfoA_New
     #define MediaInfo_New_Quick         MediaInfoA_New_Quick
@@ -298,6 +300,7 @@ MEDIAINFO_EXP size_t            __stdcall MediaInfo_Count_Get (void* Handle, Med
     #define MediaInfo_Option            MediaInfoA_Option
     #define MediaInfo_State_Get         MediaInfoA_State_Get
     #define MediaInfo_Count_Get         MediaInfoA_Count_Get
+    #define MediaInfo_Get_Batch         MediaInfoA_Get_Batch
 #endif //defined(MEDIAINFO_DLL_EXPORT) || (defined(UNICODE) || defined(_UNICODE))
 
 /** @brief A 'new' MediaInfo interface, return a Handle, don't forget to delete it after using it*/
@@ -344,6 +347,8 @@ MEDIAINFO_EXP const char*       __stdcall MediaInfoA_Option (void* Handle, const
 MEDIAINFO_EXP size_t            __stdcall MediaInfoA_State_Get (void* Handle);
 /** @brief Wrapper for MediaInfoLib::MediaInfo::Count_Get */
 MEDIAINFO_EXP size_t            __stdcall MediaInfoA_Count_Get (void* Handle, MediaInfo_stream_C StreamKind, size_t StreamNumber); /*Default : StreamNumber=-1*/
+/** @brief Wrapper for MediaInfoLib::MediaInfo::Get (batch), Results are valid until the next call with this Handle */
+MEDIAINFO_EXP size_t            __stdcall MediaInfoA_Get_Batch (void* Handle, size_t Count, const MediaInfo_stream_C* StreamKinds, const size_t* StreamNumbers, const char* const* Parameters, MediaInfo_info_C InfoKind, const char** Results); /*Default : InfoKind=Info_Text*/
 
 
 #if defined(MEDIAINFO_DLL_EXPORT) || (defined(UNICODE) || defined(_UNICODE)) //DLL construction or Unicode
@@ -450,6 +455,7 @@ MEDIAINFO_EXP size_t            __stdcall MediaInfoListA_Count_Get_Files (void*
 
 //---------------------------------------------------------------------------
 #include <string>
+#include <vector>
 //---------------------------------------------------------------------------
 
 namespace MediaInfoDLL
@@ -547,6 +553,25 @@ public :
     static String Option_Static (const String &Option, const String &Value=__T(""))  {return MediaInfo_Option (NULL, Option.c_str(), Value.c_str());};
     size_t        State_Get ()  {return MediaInfo_State_Get(Handle);};
     size_t        Count_Get (stream_t StreamKind, size_t StreamNumber=-1)  {return MediaInfo_Count_Get(Handle, (MediaInfo_stream_C)StreamKind, StreamNumber);};
+    size_t Get (size_t Count, const stream_t* StreamKinds, const size_t* StreamNumbers, const String* Parameters, String* Results, info_t InfoKind=Info_Text)
+    {
+        if (!Count)
+            return 0;
+        std::vector<MediaInfo_stream_C> StreamKinds_Temp(Count);
+        std::vector<const Char*> Parameters_Temp(Count);
+        std::vector<const Char*> Results_Temp(Count);
+        for (size_t Pos=0; Pos<Count; Pos++)
+        {
+            StreamKinds_Temp[Pos]=(MediaInfo_stream_C)StreamKinds[Pos];
+            Parameters_Temp[Pos]=Parameters[Pos].c_str();
+        }
+        size_t ToReturn=MediaInfo_Get_Batch(Handle, Count, &StreamKinds_Temp[0], StreamNumbers, &Parameters_Temp[0], (MediaInfo_info_C)InfoKind, &Results_Temp[0]);
+        if (ToReturn==(size_t)-1)
+            return ToReturn;
+        for (size_t Pos=0; Pos<Count; Pos++)
+            Results[Pos]=Results_Temp[Pos]?Results_Temp[Pos]:__T("");
+        return ToReturn;
+    }
 
 private :
     void* Handle;